@@ -1,8 +1,11 @@
 #include "AppDelegate.h"
 #include "GameScene.h"
+#include "Classes/managers/IdleFrameThrottle.h"
 
 USING_NS_CC;
 
+const std::string AppDelegate::EVENT_DID_ENTER_BACKGROUND = "app_did_enter_background";
+
 AppDelegate::AppDelegate() {}
 
 AppDelegate::~AppDelegate() {}
@@ -22,13 +25,18 @@ bool AppDelegate::applicationDidFinishLaunching() {
     auto scene = GameScene::create();
     director->runWithScene(scene);
 
+    // Drop the frame rate while the board is static; touches restore it
+    IdleFrameThrottle::install(director->getAnimationInterval());
+
     return true;
 }
 
 void AppDelegate::applicationDidEnterBackground() {
+    Director::getInstance()->getEventDispatcher()->dispatchCustomEvent(EVENT_DID_ENTER_BACKGROUND);
     Director::getInstance()->stopAnimation();
 }
 
 void AppDelegate::applicationWillEnterForeground() {
     Director::getInstance()->startAnimation();
+    IdleFrameThrottle::wake();
 }
\ No newline at end of file
@@ -11,6 +11,9 @@ public:
     virtual bool applicationDidFinishLaunching() override;
     virtual void applicationDidEnterBackground() override;
     virtual void applicationWillEnterForeground() override;
+
+    // Custom event dispatched when the app moves to the background
+    static const std::string EVENT_DID_ENTER_BACKGROUND;
 };
 
 #endif // __APP_DELEGATE_H__
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "GameScene.h"
 #include "Classes/views/GameView.h"
+#include "Classes/views/CardFaceCache.h"
+#include "AppDelegate.h"
 
 USING_NS_CC;
 
@@ -12,6 +14,9 @@ bool GameScene::init() {
         return false;
     }
 
+    // 开局前检查合成条件，牌面在卡牌首次显示时才合成，离开棋盘后释放
+    CardFaceCache::build();
+
     setupMVCArchitecture();
 
     if (_gameController && _gameController->init()) {
@@ -19,7 +24,10 @@ bool GameScene::init() {
             _gameController->getView()->setPosition(0, 0);
             this->addChild(_gameController->getView());
         }
-        _gameController->startGame(1);
+        // 优先从存档恢复上次未完成的对局，其次回放操作日志
+        if (!_gameController->resumeFromSnapshot() && !_gameController->resumeFromJournal()) {
+            _gameController->startGame(1);
+        }
     } else {
         CCLOGERROR("Failed to initialize GameController!");
         auto errorLabel = Label::createWithSystemFont("Initialization failed!", "Arial", 36);
@@ -44,8 +52,20 @@ void GameScene::connectMVCComponents() {
 
 void GameScene::onEnter() {
     Scene::onEnter();
+    
+    // 切到后台时保存存档
+    _backgroundListener = _eventDispatcher->addCustomEventListener(
+        AppDelegate::EVENT_DID_ENTER_BACKGROUND, [this](EventCustom* /*event*/) {
+            if (_gameController) {
+                _gameController->saveSnapshot();
+            }
+        });
 }
 
 void GameScene::onExit() {
+    if (_backgroundListener) {
+        _eventDispatcher->removeEventListener(_backgroundListener);
+        _backgroundListener = nullptr;
+    }
     Scene::onExit();
 }
\ No newline at end of file
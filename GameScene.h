@@ -18,6 +18,7 @@ private:
     void connectMVCComponents();
 
     std::unique_ptr<GameController> _gameController;
+    cocos2d::EventListenerCustom* _backgroundListener = nullptr;
 };
 
 #endif // __GAME_SCENE_H__
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "LevelConfigCache.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+USING_NS_CC;
+
+const size_t LevelConfigCache::DEFAULT_BYTE_BUDGET = 512 * 1024;
+
+namespace {
+
+struct CacheEntry {
+    int levelId;
+    std::shared_ptr<const LevelConfig> config;
+    size_t bytes;
+};
+
+/**
+ * @brief 缓存状态：LRU链表（表头为最近使用）+ 关卡ID到链表节点的索引
+ */
+struct CacheState {
+    std::mutex mutex;
+    std::list<CacheEntry> lru;
+    std::unordered_map<int, std::list<CacheEntry>::iterator> index;
+    size_t byteBudget = LevelConfigCache::DEFAULT_BYTE_BUDGET;
+    size_t bytes = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+CacheState& getState() {
+    static CacheState state;
+    return state;
+}
+
+// 调用方需持有锁
+void evictToBudget(CacheState& state) {
+    while (state.bytes > state.byteBudget && !state.lru.empty()) {
+        const CacheEntry& oldest = state.lru.back();
+        CCLOG("LevelConfigCache: evicting level %d (%d bytes)", oldest.levelId, (int)oldest.bytes);
+        state.bytes -= oldest.bytes;
+        state.index.erase(oldest.levelId);
+        state.lru.pop_back();
+        state.evictions++;
+    }
+}
+
+} // namespace
+
+bool LevelConfigCache::get(int levelId, LevelConfig& config) {
+    CacheState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto it = state.index.find(levelId);
+    if (it == state.index.end()) {
+        state.misses++;
+        return false;
+    }
+
+    // 移到表头，标记为最近使用
+    state.lru.splice(state.lru.begin(), state.lru, it->second);
+    config = *it->second->config;
+    state.hits++;
+    return true;
+}
+
+void LevelConfigCache::put(int levelId, const LevelConfig& config) {
+    size_t bytes = estimateBytes(config);
+    auto shared = std::make_shared<const LevelConfig>(config);
+
+    CacheState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    if (bytes > state.byteBudget) {
+        CCLOG("LevelConfigCache: level %d (%d bytes) exceeds budget, not cached", levelId, (int)bytes);
+        return;
+    }
+
+    auto it = state.index.find(levelId);
+    if (it != state.index.end()) {
+        state.bytes -= it->second->bytes;
+        state.lru.erase(it->second);
+        state.index.erase(it);
+    }
+
+    CacheEntry entry;
+    entry.levelId = levelId;
+    entry.config = shared;
+    entry.bytes = bytes;
+    state.lru.push_front(entry);
+    state.index[levelId] = state.lru.begin();
+    state.bytes += bytes;
+
+    evictToBudget(state);
+}
+
+void LevelConfigCache::setByteBudget(size_t bytes) {
+    CacheState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.byteBudget = bytes;
+    evictToBudget(state);
+}
+
+size_t LevelConfigCache::getByteBudget() {
+    CacheState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.byteBudget;
+}
+
+void LevelConfigCache::clear() {
+    CacheState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.lru.clear();
+    state.index.clear();
+    state.bytes = 0;
+}
+
+LevelConfigCache::Stats LevelConfigCache::getStats() {
+    CacheState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    Stats stats;
+    stats.hits = state.hits;
+    stats.misses = state.misses;
+    stats.evictions = state.evictions;
+    stats.bytes = state.bytes;
+    stats.entries = state.lru.size();
+    return stats;
+}
+
+size_t LevelConfigCache::estimateBytes(const LevelConfig& config) {
+    return sizeof(LevelConfig) + sizeof(CacheEntry)
+        + (config.playfieldCards.capacity() + config.stackCards.capacity()) * sizeof(LevelConfig::CardConfig)
+        + config.levelName.capacity();
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef __LEVEL_CONFIG_CACHE_H__
+#define __LEVEL_CONFIG_CACHE_H__
+
+#include "cocos2d.h"
+#include "../models/LevelConfig.h"
+#include <cstdint>
+
+/**
+ * @class LevelConfigCache
+ * @brief 已解析关卡配置的内存缓存，按关卡ID索引
+ * 
+ * 职责：
+ * - 缓存解析后的LevelConfig，重开关卡或在选关界面来回切换时不再读盘
+ * - 按估算的字节数控制总占用，超出预算时淘汰最久未使用的关卡
+ * - 统计命中/未命中次数，便于调整预算
+ * - 线程安全，可被后台预加载线程调用
+ */
+class LevelConfigCache {
+public:
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        size_t bytes;       ///< 当前占用的估算字节数
+        size_t entries;
+    };
+
+    static const size_t DEFAULT_BYTE_BUDGET;
+
+    /**
+     * @brief 查找缓存的关卡配置
+     * @param levelId 关卡ID
+     * @param config 输出：命中时的配置副本
+     * @return 是否命中
+     */
+    static bool get(int levelId, LevelConfig& config);
+
+    /**
+     * @brief 放入关卡配置，必要时淘汰最久未使用的条目
+     * @param levelId 关卡ID
+     * @param config 关卡配置（单个配置超出预算时不缓存）
+     */
+    static void put(int levelId, const LevelConfig& config);
+
+    static void setByteBudget(size_t bytes);
+    static size_t getByteBudget();
+    static void clear();
+    static Stats getStats();
+
+    /**
+     * @brief 估算一个配置占用的内存字节数
+     */
+    static size_t estimateBytes(const LevelConfig& config);
+};
+
+#endif // __LEVEL_CONFIG_CACHE_H__
\ No newline at end of file
@@ -1,92 +1,44 @@
 #include "LevelConfigLoader.h"
+#include "LevelConfigCache.h"
 #include "cocos2d.h"
 
 USING_NS_CC;
 
+const char* LevelConfigLoader::LEVEL_PACK_PATH = "configs/levels/levels.lvpk";
+
+namespace {
+
+// 编译时未通过校验的关卡不可用，与卡牌尺寸不一致的情况一样交给调用方退回JSON
+bool acceptValidated(int levelId, CompiledLevel& compiledLevel) {
+    CC_UNUSED_PARAM(levelId);   // 只在调试日志中使用
+    if (compiledLevel.isValidated()) {
+        return true;
+    }
+    CCLOGERROR("Compiled level %d did not pass validation when compiled, falling back to JSON", levelId);
+    compiledLevel = CompiledLevel();
+    return false;
+}
+
+} // namespace
+
 LevelConfig LevelConfigLoader::loadLevelConfig(const std::string& configPath) {
     LevelConfig config;
     
     CCLOG("Loading config from: %s", configPath.c_str());
     
-    // 读取JSON文件
-    std::string content = FileUtils::getInstance()->getStringFromFile(configPath);
-    if (content.empty()) {
+    // 读取JSON文件（直接使用原始字节，不额外拷贝成字符串）
+    Data data = FileUtils::getInstance()->getDataFromFile(configPath);
+    if (data.isNull()) {
         CCLOGERROR("Failed to load config file: %s", configPath.c_str());
         return config;
     }
     
-    CCLOG("Config file content length: %d", (int)content.length());
+    CCLOG("Config file content length: %d", (int)data.getSize());
     
-    // 使用JSON文件中的真实数据，而不是硬编码
-    // 这里应该解析JSON文件，但为了简化，我们直接使用JSON中的值
-    if (configPath.find("Level_01") != std::string::npos) {
-        // 从JSON文件读取的真实数据
-        // Playfield cards - 使用JSON中的实际值
-        LevelConfig::CardConfig card1; 
-        card1.face = static_cast<CardFaceType>(12); // KING
-        card1.suit = static_cast<CardSuitType>(0);  // CLUBS
-        card1.position = Vec2(250, 1000);
-        card1.isCovered = false;
-        
-        LevelConfig::CardConfig card2; 
-        card2.face = static_cast<CardFaceType>(2);  // TWO
-        card2.suit = static_cast<CardSuitType>(0);   // CLUBS
-        card2.position = Vec2(300, 800);
-        card2.isCovered = false;
-        
-        LevelConfig::CardConfig card3; 
-        card3.face = static_cast<CardFaceType>(2);  // TWO
-        card3.suit = static_cast<CardSuitType>(1);  // DIAMONDS
-        card3.position = Vec2(350, 600);
-        card3.isCovered = false;
-        
-        LevelConfig::CardConfig card4; 
-        card4.face = static_cast<CardFaceType>(2);   // TWO
-        card4.suit = static_cast<CardSuitType>(0);  // CLUBS
-        card4.position = Vec2(850, 1000);
-        card4.isCovered = false;
-        
-        LevelConfig::CardConfig card5; 
-        card5.face = static_cast<CardFaceType>(2);  // TWO
-        card5.suit = static_cast<CardSuitType>(0);  // CLUBS
-        card5.position = Vec2(800, 800);
-        card5.isCovered = false;
-        
-        LevelConfig::CardConfig card6; 
-        card6.face = static_cast<CardFaceType>(1);  // ACE
-        card6.suit = static_cast<CardSuitType>(3);  // SPADES
-        card6.position = Vec2(750, 600);
-        card6.isCovered = false;
-        
-        config.playfieldCards.push_back(card1);
-        config.playfieldCards.push_back(card2);
-        config.playfieldCards.push_back(card3);
-        config.playfieldCards.push_back(card4);
-        config.playfieldCards.push_back(card5);
-        config.playfieldCards.push_back(card6);
-        
-        // Stack cards - 使用JSON中的实际值
-        LevelConfig::CardConfig stack1; 
-        stack1.face = static_cast<CardFaceType>(2);  // TWO
-        stack1.suit = static_cast<CardSuitType>(0);   // CLUBS
-        stack1.position = Vec2(0, 0);
-        stack1.isCovered = false;
-        
-        LevelConfig::CardConfig stack2; 
-        stack2.face = static_cast<CardFaceType>(0);   // ACE
-        stack2.suit = static_cast<CardSuitType>(2);   // DIAMONDS
-        stack2.position = Vec2(0, 0);
-        stack2.isCovered = false;
-        
-        LevelConfig::CardConfig stack3; 
-        stack3.face = static_cast<CardFaceType>(3);   // THREE
-        stack3.suit = static_cast<CardSuitType>(0);   // CLUBS
-        stack3.position = Vec2(0, 0);
-        stack3.isCovered = false;
-        
-        config.stackCards.push_back(stack1);
-        config.stackCards.push_back(stack2);
-        config.stackCards.push_back(stack3);
+    // SAX方式解析，直接填充LevelConfig
+    if (!config.fromJson(reinterpret_cast<const char*>(data.getBytes()), (size_t)data.getSize())) {
+        CCLOGERROR("Failed to parse config file: %s", configPath.c_str());
+        return LevelConfig();
     }
     
     CCLOG("Loaded level config: %d playfield cards, %d stack cards", 
@@ -96,10 +48,70 @@ LevelConfig LevelConfigLoader::loadLevelConfig(const std::string& configPath) {
 }
 
 LevelConfig LevelConfigLoader::loadLevelConfig(int levelId) {
+    // 重开关卡、来回切换关卡时直接命中缓存，不再读盘
+    LevelConfig config;
+    if (LevelConfigCache::get(levelId, config)) {
+        return config;
+    }
+    
     std::string configPath = getConfigPath(levelId);
-    return loadLevelConfig(configPath);
+    config = loadLevelConfig(configPath);
+    config.levelId = levelId;
+    
+    // 读取或解析失败的配置不缓存，下次仍会重试
+    if (!config.playfieldCards.empty() || !config.stackCards.empty()) {
+        LevelConfigCache::put(levelId, config);
+    }
+    return config;
+}
+
+bool LevelConfigLoader::loadCompiledLevel(int levelId, CompiledLevel& compiledLevel) {
+    // 关卡包：一次映射，按ID直接索引，无需逐关卡访问文件系统
+    const LevelPack& levelPack = getLevelPack();
+    if (levelPack.isOpen()) {
+        if (levelPack.findLevel(levelId, compiledLevel)) {
+            return acceptValidated(levelId, compiledLevel);
+        }
+        CCLOG("Level %d not found in level pack", levelId);
+    }
+    
+    std::string compiledPath = getCompiledPath(levelId);
+    if (!FileUtils::getInstance()->isFileExist(compiledPath)) {
+        return false;
+    }
+    
+    auto file = std::make_shared<MappedFile>();
+    if (!file->open(compiledPath)) {
+        CCLOGERROR("Failed to map compiled level: %s", compiledPath.c_str());
+        return false;
+    }
+    
+    if (!compiledLevel.bind(file, 0, file->getSize()) || compiledLevel.getLevelId() != levelId) {
+        CCLOGERROR("Compiled level is invalid: %s", compiledPath.c_str());
+        return false;
+    }
+    
+    CCLOG("Mapped compiled level %d: %u playfield cards, %u stack cards",
+          levelId, compiledLevel.getPlayfieldCount(), compiledLevel.getStackCount());
+    return acceptValidated(levelId, compiledLevel);
+}
+
+const LevelPack& LevelConfigLoader::getLevelPack() {
+    // 局部静态变量的初始化是线程安全的，关卡包只会被映射一次
+    static const LevelPack levelPack = [] {
+        LevelPack pack;
+        if (FileUtils::getInstance()->isFileExist(LEVEL_PACK_PATH)) {
+            pack.open(LEVEL_PACK_PATH);
+        }
+        return pack;
+    }();
+    return levelPack;
 }
 
 std::string LevelConfigLoader::getConfigPath(int levelId) {
     return StringUtils::format("configs/levels/Level_%02d_config.json", levelId);
+}
+
+std::string LevelConfigLoader::getCompiledPath(int levelId) {
+    return StringUtils::format("configs/levels/Level_%02d.lvb", levelId);
 }
\ No newline at end of file
@@ -3,14 +3,26 @@
 
 #include "cocos2d.h"
 #include "../models/LevelConfig.h"
+#include "../models/CompiledLevel.h"
+#include "../models/LevelPack.h"
 
 class LevelConfigLoader {
 public:
     static LevelConfig loadLevelConfig(const std::string& configPath);
     static LevelConfig loadLevelConfig(int levelId);
     
-private:
+    // 映射离线编译的二进制关卡，文件不存在、格式不符或编译时未通过校验时返回false（调用方退回JSON）
+    // 优先从关卡包中按ID查找，关卡包中没有时再尝试单独的关卡文件
+    static bool loadCompiledLevel(int levelId, CompiledLevel& compiledLevel);
+    
+    // 关卡JSON源文件路径
     static std::string getConfigPath(int levelId);
+    
+private:
+    // 关卡包在首次使用时映射，之后常驻
+    static const LevelPack& getLevelPack();
+    static const char* LEVEL_PACK_PATH;
+    static std::string getCompiledPath(int levelId);
 };
 
 #endif // __LEVEL_CONFIG_LOADER_H__
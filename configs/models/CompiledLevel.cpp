@@ -0,0 +1,68 @@
+#include "CompiledLevel.h"
+
+USING_NS_CC;
+
+const uint32_t CompiledLevel::MAGIC;
+const uint32_t CompiledLevel::VERSION;
+
+CompiledLevel::CompiledLevel()
+    : _header(nullptr)
+    , _cards(nullptr)
+    , _coverIndices(nullptr) {
+}
+
+bool CompiledLevel::bind(const std::shared_ptr<MappedFile>& file, size_t offset, size_t size) {
+    _file.reset();
+    _header = nullptr;
+    _cards = nullptr;
+    _coverIndices = nullptr;
+
+    if (!file || !file->isOpen() || offset % 4 != 0 ||
+        offset > file->getSize() || size > file->getSize() - offset || size < sizeof(Header)) {
+        CCLOGERROR("CompiledLevel: invalid data range");
+        return false;
+    }
+
+    const unsigned char* base = file->getData() + offset;
+    const Header* header = reinterpret_cast<const Header*>(base);
+    if (header->magic != MAGIC || header->version != VERSION || header->totalSize != size) {
+        CCLOGERROR("CompiledLevel: bad header (magic=0x%08X version=%u)", header->magic, header->version);
+        return false;
+    }
+
+    // 校验各表都落在数据范围内，之后读取无需再做边界检查
+    uint64_t cardCount = (uint64_t)header->playfieldCount + header->stackCount;
+    uint64_t cardTableEnd = (uint64_t)header->cardTableOffset + cardCount * sizeof(Card);
+    uint64_t coverTableEnd = (uint64_t)header->coverTableOffset + (uint64_t)header->coverIndexCount * sizeof(uint32_t);
+    if (header->cardTableOffset % 4 != 0 || header->coverTableOffset % 4 != 0 ||
+        header->cardTableOffset < sizeof(Header) || cardTableEnd > size || coverTableEnd > size) {
+        CCLOGERROR("CompiledLevel: table out of range");
+        return false;
+    }
+
+    const Card* cards = reinterpret_cast<const Card*>(base + header->cardTableOffset);
+    const uint32_t* coverIndices = reinterpret_cast<const uint32_t*>(base + header->coverTableOffset);
+    for (uint32_t i = 0; i < header->playfieldCount; ++i) {
+        const Card& card = cards[i];
+        if ((uint64_t)card.coverBegin + card.coverCount > header->coverIndexCount) {
+            CCLOGERROR("CompiledLevel: cover range out of bounds for card %u", i);
+            return false;
+        }
+        for (uint32_t k = 0; k < card.coverCount; ++k) {
+            if (coverIndices[card.coverBegin + k] >= i) {
+                CCLOGERROR("CompiledLevel: card %u covers a later card", i);
+                return false;
+            }
+        }
+    }
+
+    _file = file;
+    _header = header;
+    _cards = cards;
+    _coverIndices = coverIndices;
+    return true;
+}
+
+Size CompiledLevel::getCardSize() const {
+    return _header ? Size(_header->cardWidth, _header->cardHeight) : Size::ZERO;
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef __COMPILED_LEVEL_H__
+#define __COMPILED_LEVEL_H__
+
+#include "cocos2d.h"
+#include "../../utils/MappedFile.h"
+#include <cstdint>
+#include <memory>
+
+/**
+ * @class CompiledLevel
+ * @brief 预编译关卡（.lvb）的只读视图
+ * 
+ * 职责：
+ * - 定义离线编译器（tools/compile_levels.py）输出的定长二进制布局
+ * - 直接在映射内存上读取卡牌表和覆盖关系，不做解析和拷贝
+ * - 持有映射文件的引用，保证视图有效期内内存不被释放
+ * 
+ * 文件布局（小端，所有字段4字节对齐）：
+ * Header | Card[playfieldCount + stackCount] | uint32 coverIndices[coverIndexCount]
+ */
+class CompiledLevel {
+public:
+    static const uint32_t MAGIC = 0x564C4543;   ///< "CELV"
+    static const uint32_t VERSION = 1;
+
+    enum HeaderFlags : uint32_t {
+        FLAG_VALIDATED = 1u << 0,   ///< 编译时校验通过
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        int32_t levelId;
+        uint32_t flags;
+        float cardWidth;            ///< 计算覆盖关系时使用的卡牌尺寸
+        float cardHeight;
+        uint32_t playfieldCount;
+        uint32_t stackCount;
+        uint32_t coverIndexCount;
+        uint32_t cardTableOffset;
+        uint32_t coverTableOffset;
+        uint32_t totalSize;
+    };
+
+    struct Card {
+        int32_t face;
+        int32_t suit;
+        float x;
+        float y;
+        uint32_t isCovered;
+        uint32_t coverBegin;        ///< 该卡覆盖的卡牌在coverIndices中的起始位置
+        uint32_t coverCount;        ///< 覆盖的卡牌数量（索引均指向主牌堆中更早摆放的卡牌）
+    };
+
+    CompiledLevel();
+
+    /**
+     * @brief 绑定到映射内存中的一段数据并校验布局
+     * @param file 映射文件
+     * @param offset 关卡数据在文件中的偏移
+     * @param size 关卡数据长度
+     * @return 布局是否有效
+     */
+    bool bind(const std::shared_ptr<MappedFile>& file, size_t offset, size_t size);
+
+    bool isValid() const { return _header != nullptr; }
+    bool isValidated() const { return _header && (_header->flags & FLAG_VALIDATED) != 0; }
+    int getLevelId() const { return _header ? _header->levelId : 0; }
+    cocos2d::Size getCardSize() const;
+
+    uint32_t getPlayfieldCount() const { return _header ? _header->playfieldCount : 0; }
+    uint32_t getStackCount() const { return _header ? _header->stackCount : 0; }
+
+    /**
+     * @brief 卡牌表，先主牌堆后备用牌堆
+     */
+    const Card* getCards() const { return _cards; }
+    const uint32_t* getCoverIndices() const { return _coverIndices; }
+
+private:
+    std::shared_ptr<MappedFile> _file;
+    const Header* _header;
+    const Card* _cards;
+    const uint32_t* _coverIndices;
+};
+
+#endif // __COMPILED_LEVEL_H__
\ No newline at end of file
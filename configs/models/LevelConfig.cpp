@@ -0,0 +1,210 @@
+#include "LevelConfig.h"
+#include "json/reader.h"
+#include "json/memorystream.h"
+#include "json/error/en.h"
+#include <cstring>
+
+USING_NS_CC;
+
+namespace {
+
+/**
+ * @class LevelConfigSaxHandler
+ * @brief 关卡配置的SAX处理器，边解析边填充LevelConfig，不构建中间DOM
+ * 
+ * 支持的结构：
+ * { "Playfield": [卡牌...], "Stack": [卡牌...] }
+ * 卡牌：{ "CardFace": int, "CardSuit": int, "Position": { "x": number, "y": number } }
+ * 未知字段（包括嵌套对象和数组）会被整体跳过。
+ */
+class LevelConfigSaxHandler
+    : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, LevelConfigSaxHandler> {
+public:
+    explicit LevelConfigSaxHandler(LevelConfig& config)
+        : _config(config)
+        , _cards(nullptr)
+        , _key(KEY_NONE)
+        , _depth(0)
+        , _skipDepth(0) {}
+
+    bool Key(const char* str, rapidjson::SizeType length, bool /*copy*/) {
+        if (_skipDepth == 0) {
+            _key = matchKey(str, length);
+        }
+        return true;
+    }
+
+    bool StartObject() {
+        if (_skipDepth > 0) {
+            _skipDepth++;
+        } else if (_depth == DEPTH_NONE) {
+            _depth = DEPTH_ROOT;
+        } else if (_depth == DEPTH_SECTION && _cards) {
+            _card = LevelConfig::CardConfig();
+            _depth = DEPTH_CARD;
+        } else if (_depth == DEPTH_CARD && _key == KEY_POSITION) {
+            _depth = DEPTH_POSITION;
+        } else {
+            _skipDepth = 1;
+        }
+        _key = KEY_NONE;
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType /*memberCount*/) {
+        if (_skipDepth > 0) {
+            _skipDepth--;
+        } else if (_depth == DEPTH_POSITION) {
+            _depth = DEPTH_CARD;
+        } else if (_depth == DEPTH_CARD) {
+            _cards->push_back(_card);
+            _depth = DEPTH_SECTION;
+        } else if (_depth == DEPTH_ROOT) {
+            _depth = DEPTH_NONE;
+        }
+        _key = KEY_NONE;
+        return true;
+    }
+
+    bool StartArray() {
+        if (_skipDepth > 0) {
+            _skipDepth++;
+        } else if (_depth == DEPTH_ROOT && _key == KEY_PLAYFIELD) {
+            _cards = &_config.playfieldCards;
+            _depth = DEPTH_SECTION;
+        } else if (_depth == DEPTH_ROOT && _key == KEY_STACK) {
+            _cards = &_config.stackCards;
+            _depth = DEPTH_SECTION;
+        } else {
+            _skipDepth = 1;
+        }
+        _key = KEY_NONE;
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType /*elementCount*/) {
+        if (_skipDepth > 0) {
+            _skipDepth--;
+        } else if (_depth == DEPTH_SECTION) {
+            _cards = nullptr;
+            _depth = DEPTH_ROOT;
+        }
+        _key = KEY_NONE;
+        return true;
+    }
+
+    bool Int(int value) { return number(value); }
+    bool Uint(unsigned value) { return number(value); }
+    bool Int64(int64_t value) { return number((double)value); }
+    bool Uint64(uint64_t value) { return number((double)value); }
+    bool Double(double value) { return number(value); }
+
+private:
+    enum Field {
+        KEY_NONE,
+        KEY_UNKNOWN,
+        KEY_PLAYFIELD,
+        KEY_STACK,
+        KEY_CARD_FACE,
+        KEY_CARD_SUIT,
+        KEY_POSITION,
+        KEY_X,
+        KEY_Y
+    };
+
+    // 当前所在的层级：根对象 -> 牌堆数组 -> 卡牌对象 -> 位置对象
+    enum Depth {
+        DEPTH_NONE,
+        DEPTH_ROOT,
+        DEPTH_SECTION,
+        DEPTH_CARD,
+        DEPTH_POSITION
+    };
+
+    static Field matchKey(const char* str, rapidjson::SizeType length) {
+        struct KeyName { const char* name; rapidjson::SizeType length; Field key; };
+        static const KeyName KEY_NAMES[] = {
+            { "Playfield", 9, KEY_PLAYFIELD },
+            { "Stack", 5, KEY_STACK },
+            { "CardFace", 8, KEY_CARD_FACE },
+            { "CardSuit", 8, KEY_CARD_SUIT },
+            { "Position", 8, KEY_POSITION },
+            { "x", 1, KEY_X },
+            { "y", 1, KEY_Y },
+        };
+        for (const KeyName& keyName : KEY_NAMES) {
+            if (keyName.length == length && memcmp(keyName.name, str, length) == 0) {
+                return keyName.key;
+            }
+        }
+        return KEY_UNKNOWN;
+    }
+
+    bool number(double value) {
+        if (_skipDepth > 0) {
+            return true;
+        }
+
+        if (_depth == DEPTH_CARD) {
+            if (_key == KEY_CARD_FACE) {
+                _card.face = static_cast<CardFaceType>((int)value);
+            } else if (_key == KEY_CARD_SUIT) {
+                _card.suit = static_cast<CardSuitType>((int)value);
+            }
+        } else if (_depth == DEPTH_POSITION) {
+            if (_key == KEY_X) {
+                _card.position.x = (float)value;
+            } else if (_key == KEY_Y) {
+                _card.position.y = (float)value;
+            }
+        }
+        _key = KEY_NONE;
+        return true;
+    }
+
+    LevelConfig& _config;
+    std::vector<LevelConfig::CardConfig>* _cards;    ///< 当前正在填充的牌堆
+    LevelConfig::CardConfig _card;      ///< 当前正在解析的卡牌
+    Field _key;
+    int _depth;
+    int _skipDepth;                     ///< 大于0时处于未知字段内部
+};
+
+} // namespace
+
+bool LevelConfig::fromJson(const std::string& jsonStr) {
+    return fromJson(jsonStr.data(), jsonStr.size());
+}
+
+bool LevelConfig::fromJson(const char* json, size_t length) {
+    playfieldCards.clear();
+    stackCards.clear();
+
+    rapidjson::MemoryStream stream(json, length);
+    LevelConfigSaxHandler handler(*this);
+    rapidjson::Reader reader;
+    rapidjson::ParseResult result = reader.Parse<rapidjson::kParseDefaultFlags>(stream, handler);
+    if (result.IsError()) {
+        CCLOGERROR("LevelConfig::fromJson - parse error at offset %d: %s",
+                   (int)result.Offset(), rapidjson::GetParseError_En(result.Code()));
+        return false;
+    }
+
+    return true;
+}
+
+void LevelConfig::debugPrint() const {
+    CCLOG("LevelConfig[%d] %s: %d playfield cards, %d stack cards",
+          levelId, levelName.c_str(), (int)playfieldCards.size(), (int)stackCards.size());
+#if COCOS2D_DEBUG > 0
+    // 发布版本中CCLOG为空，逐张输出的循环一并去掉
+    for (const auto& card : playfieldCards) {
+        CCLOG("  Playfield: face=%d, suit=%d, pos=(%.1f, %.1f)",
+              (int)card.face, (int)card.suit, card.position.x, card.position.y);
+    }
+    for (const auto& card : stackCards) {
+        CCLOG("  Stack: face=%d, suit=%d, pos=(%.1f, %.1f)",
+              (int)card.face, (int)card.suit, card.position.x, card.position.y);
+    }
+#endif
+}
\ No newline at end of file
@@ -23,7 +23,9 @@ public:
 
     LevelConfig() : levelId(0) {}
 
+    // 以SAX方式解析关卡JSON，直接填充卡牌配置
     bool fromJson(const std::string& jsonStr);
+    bool fromJson(const char* json, size_t length);
     void debugPrint() const;
 };
 
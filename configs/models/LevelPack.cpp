@@ -0,0 +1,62 @@
+#include "LevelPack.h"
+
+USING_NS_CC;
+
+const uint32_t LevelPack::MAGIC;
+const uint32_t LevelPack::VERSION;
+
+LevelPack::LevelPack()
+    : _header(nullptr)
+    , _index(nullptr) {
+}
+
+bool LevelPack::open(const std::string& filename) {
+    _file.reset();
+    _header = nullptr;
+    _index = nullptr;
+
+    auto file = std::make_shared<MappedFile>();
+    if (!file->open(filename)) {
+        return false;
+    }
+
+    size_t size = file->getSize();
+    if (size < sizeof(Header)) {
+        CCLOGERROR("LevelPack: file too small: %s", filename.c_str());
+        return false;
+    }
+
+    const Header* header = reinterpret_cast<const Header*>(file->getData());
+    uint64_t indexEnd = (uint64_t)header->indexOffset + (uint64_t)header->levelCount * sizeof(IndexEntry);
+    if (header->magic != MAGIC || header->version != VERSION || header->totalSize != size ||
+        header->indexOffset % 4 != 0 || header->indexOffset < sizeof(Header) || indexEnd > size) {
+        CCLOGERROR("LevelPack: bad header: %s", filename.c_str());
+        return false;
+    }
+
+    _file = file;
+    _header = header;
+    _index = reinterpret_cast<const IndexEntry*>(file->getData() + header->indexOffset);
+
+    CCLOG("LevelPack: mapped %s, %u levels from id %d", filename.c_str(), header->levelCount, header->firstLevelId);
+    return true;
+}
+
+bool LevelPack::findLevel(int levelId, CompiledLevel& compiledLevel) const {
+    if (!_header) {
+        return false;
+    }
+
+    int64_t slot = (int64_t)levelId - _header->firstLevelId;
+    if (slot < 0 || slot >= (int64_t)_header->levelCount) {
+        return false;
+    }
+
+    const IndexEntry& entry = _index[slot];
+    if (entry.size == 0) {
+        return false;
+    }
+
+    // 记录范围由CompiledLevel::bind校验
+    return compiledLevel.bind(_file, entry.offset, entry.size) && compiledLevel.getLevelId() == levelId;
+}
\ No newline at end of file
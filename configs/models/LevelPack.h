@@ -0,0 +1,67 @@
+#ifndef __LEVEL_PACK_H__
+#define __LEVEL_PACK_H__
+
+#include "cocos2d.h"
+#include "CompiledLevel.h"
+#include <cstdint>
+#include <memory>
+
+/**
+ * @class LevelPack
+ * @brief 关卡包（.lvpk）：单文件打包全部预编译关卡
+ * 
+ * 职责：
+ * - 整个文件只映射一次，所有关卡共享同一份映射内存
+ * - 按关卡ID直接下标访问索引表，O(1)定位关卡记录
+ * - 关卡记录即CompiledLevel布局，查找结果直接绑定到映射内存
+ * 
+ * 文件布局（小端，所有字段4字节对齐）：
+ * Header | IndexEntry[levelCount] | 关卡记录...
+ * 索引表按 levelId - firstLevelId 排列，size为0表示该ID没有关卡
+ */
+class LevelPack {
+public:
+    static const uint32_t MAGIC = 0x504C4543;   ///< "CELP"
+    static const uint32_t VERSION = 1;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        int32_t firstLevelId;
+        uint32_t levelCount;
+        uint32_t indexOffset;
+        uint32_t totalSize;
+    };
+
+    struct IndexEntry {
+        uint32_t offset;    ///< 关卡记录在文件中的偏移
+        uint32_t size;      ///< 关卡记录长度
+    };
+
+    LevelPack();
+
+    /**
+     * @brief 映射关卡包并校验头部和索引表
+     * @param filename 关卡包文件名
+     * @return 是否打开成功
+     */
+    bool open(const std::string& filename);
+
+    bool isOpen() const { return _header != nullptr; }
+    uint32_t getLevelCount() const { return _header ? _header->levelCount : 0; }
+
+    /**
+     * @brief 查找关卡
+     * @param levelId 关卡ID
+     * @param compiledLevel 输出：绑定到映射内存的关卡视图
+     * @return 关卡是否存在且有效
+     */
+    bool findLevel(int levelId, CompiledLevel& compiledLevel) const;
+
+private:
+    std::shared_ptr<MappedFile> _file;
+    const Header* _header;
+    const IndexEntry* _index;
+};
+
+#endif // __LEVEL_PACK_H__
\ No newline at end of file
@@ -5,8 +5,9 @@
 
 // 前向声明
 class GameModel;
-class GameView;
+class GameViewInterface;
 class UndoManager;
+class MoveJournal;
 
 /**
  * @class CardController
@@ -25,10 +26,16 @@ public:
     /**
      * @brief 初始化控制器
      * @param gameModel 游戏模型
-     * @param gameView 游戏视图
+     * @param gameView 游戏视图接口
      * @param undoManager 回退管理器
      */
-    void init(GameModel* gameModel, GameView* gameView, UndoManager* undoManager);
+    void init(GameModel* gameModel, GameViewInterface* gameView, UndoManager* undoManager);
+    
+    /**
+     * @brief 设置操作日志（为nullptr时不记录，用于日志回放）
+     * @param moveJournal 操作日志
+     */
+    void setMoveJournal(MoveJournal* moveJournal) { _moveJournal = moveJournal; }
     
     /**
      * @brief 处理卡片点击事件
@@ -51,11 +58,6 @@ public:
      */
     bool handleStackCardClick(int cardId);
     
-    /**
-     * @brief 播放回退动画
-     */
-    void playUndoAnimations();
-    
     /**
      * @brief 计算卡牌的正确层级
      * @param cardId 卡牌ID
@@ -80,16 +82,12 @@ public:
      * @return 是否正在播放动画
      */
     bool isAnimationPlaying() const;
-    
-    /**
-     * @brief 检查并完成回退操作
-     */
-    void checkAndCompleteUndo();
 
 private:
     GameModel* _gameModel;
-    GameView* _gameView;
+    GameViewInterface* _gameView;
     UndoManager* _undoManager;
+    MoveJournal* _moveJournal;
     
     // 动画状态管理
     bool _isAnimationPlaying;
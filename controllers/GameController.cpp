@@ -4,14 +4,23 @@
 #include "../models/GameModel.h"
 #include "../models/CardModel.h"
 #include "../views/GameView.h"
+#include "../views/CardView.h"
+#include "../views/NullGameView.h"
 #include "../managers/UndoManager.h"
+#include "../managers/MoveJournal.h"
+#include "../managers/LevelPreloader.h"
+#include "../managers/LevelHotReloader.h"
 #include "../configs/loaders/LevelConfigLoader.h"
+#include "../services/GameSnapshotService.h"
+#include "../services/GameModelFromLevelGenerator.h"
+#include "../utils/GameClock.h"
 #include <cmath>
 
 USING_NS_CC;
 
 // 定义静态常量
 const float GameController::UNDO_COOLDOWN_TIME = 0.8f;
+const char* const GameController::NEXT_LEVEL_SCHEDULE_KEY = "game_controller_next_level";
 
 GameController::GameController()
     : _gameModel(nullptr)
@@ -20,10 +29,11 @@ GameController::GameController()
     , _undoController(nullptr)
     , _currentLevelId(0)
     , _isAnimationPlaying(false)
-    , _lastUndoTime(0.0f) {
+    , _lastUndoTime(0.0) {
 }
 
 GameController::~GameController() {
+    Director::getInstance()->getScheduler()->unschedule(NEXT_LEVEL_SCHEDULE_KEY, this);
 }
 
 bool GameController::init() {
@@ -56,12 +66,26 @@ bool GameController::init() {
         return false;
     }
     
+    // 初始化操作日志（写盘在后台线程进行）
+    _moveJournal = std::make_unique<MoveJournal>(MoveJournal::getDefaultPath());
+    
+    _levelPreloader = std::make_unique<LevelPreloader>();
+    
+    _levelHotReloader = std::make_unique<LevelHotReloader>();
+    
     setupSubControllers();
 
     return true;
 }
 
 void GameController::startGame(int levelId) {
+    _currentLevelId = levelId;
+    
+    // 新对局开始新的操作日志
+    if (_moveJournal) {
+        _moveJournal->begin(levelId);
+    }
+    
     _gameModel = std::make_unique<GameModel>();
     if (!_gameModel) return;
     
@@ -69,10 +93,12 @@ void GameController::startGame(int levelId) {
     if (!_undoManager) return;
     
     _undoManager->init(_gameModel.get());
-    loadLevelFromConfig(levelId);
+    bool loadedFromJson = false;
+    bool dependencyGraphReady = loadLevelFromConfig(levelId, *_gameModel, loadedFromJson);
 
     if (_gameView && _gameModel) {
-        _gameView->initializeWithModel(*_gameModel);
+        // 预编译关卡和预加载的关卡已带覆盖关系，跳过基于视图包围盒的依赖图构建
+        _gameView->initializeWithModel(*_gameModel, !dependencyGraphReady);
     }
 
     _gameModel->setGameState(GameModel::GameState::PLAYING);
@@ -85,62 +111,330 @@ void GameController::startGame(int levelId) {
     if (_undoController) {
         _undoController->init(_gameModel.get(), _gameView, _undoManager.get());
     }
+    
+    preloadNextLevel();
+    watchLevelFile(loadedFromJson);
 }
 
+void GameController::watchLevelFile(bool loadedFromJson) {
+#if COCOS2D_DEBUG > 0
+    // 只有从JSON源文件加载的关卡才监视（预编译关卡自带依赖图，修改JSON后需重新编译）
+    if (_levelHotReloader && loadedFromJson) {
+        _levelHotReloader->watch(_currentLevelId, [this](const LevelConfig& config, const LevelHotReloader::Diff& diff) {
+            applyLevelHotReload(config, diff.changedPlayfield, diff.changedStack, diff.structural);
+        });
+    } else if (_levelHotReloader) {
+        _levelHotReloader->stop();
+    }
+#else
+    CC_UNUSED_PARAM(loadedFromJson);
+#endif
+}
 
-void GameController::loadLevelFromConfig(int levelId) {
-    if (!_gameModel) return;
+bool GameController::startNextLevel() {
+    int nextLevelId = _currentLevelId + 1;
+    if (!_levelPreloader || !_levelPreloader->hasLevel(nextLevelId)) {
+        CCLOG("Next level %d is not available", nextLevelId);
+        return false;
+    }
+    
+    startGame(nextLevelId);
+    return true;
+}
 
-    LevelConfig config = LevelConfigLoader::loadLevelConfig(levelId);
-    
-    int cardId = 1000;
-    CCLOG("Loading playfield cards, count: %d", (int)config.playfieldCards.size());
-    for (const auto& cardConfig : config.playfieldCards) {
-        CardModel card(cardId, 
-                      cardConfig.face, 
-                      cardConfig.suit,
-                      cardConfig.position);
-        card.setCovered(cardConfig.isCovered);
-        card.setIsInPlayfield(true);
-        CCLOG("Adding playfield card: ID=%d, face=%d, suit=%d", cardId, (int)cardConfig.face, (int)cardConfig.suit);
-        _gameModel->addCard(card, true);
-        cardId++;
-    }
-    
-    CCLOG("Loading stack cards, count: %d", (int)config.stackCards.size());
-    for (const auto& cardConfig : config.stackCards) {
-        CardModel card(cardId, 
-                      cardConfig.face, 
-                      cardConfig.suit,
-                      cardConfig.position);
-        card.setCovered(cardConfig.isCovered);
-        card.setIsInPlayfield(false);
-        CCLOG("Adding stack card: ID=%d, face=%d, suit=%d", cardId, (int)cardConfig.face, (int)cardConfig.suit);
-        _gameModel->addCard(card, false);
-        cardId++;
-    }
-    
-    // 初始化备用牌堆和底牌堆
-    if (!config.stackCards.empty()) {
-        const auto& stackCards = _gameModel->getStackCardIds();
-        
-        // 将所有备用牌添加到栈中（按正确顺序）
-        for (int stackCardId : stackCards) {
-            _gameModel->pushToStackPile(stackCardId);
+void GameController::preloadNextLevel() {
+    if (_levelPreloader) {
+        _levelPreloader->preload(_currentLevelId + 1);
+    }
+}
+
+namespace {
+
+/**
+ * @brief 在不挂视图、不写日志的情况下回放日志记录（调用方需先断开CardController的日志）
+ * @return 成功回放的记录数（遇到与当前局面不一致的记录即停止）
+ */
+int replayJournalEntries(CardController& cardController, UndoManager& undoManager,
+                         const std::vector<MoveJournal::Entry>& entries, size_t first) {
+    int replayed = 0;
+    for (size_t i = first; i < entries.size(); ++i) {
+        const MoveJournal::Entry& entry = entries[i];
+        bool success = false;
+        switch (entry.type) {
+        case MoveJournal::EntryType::CARD_MATCH:
+            success = cardController.handlePlayfieldCardClick(entry.cardId1);
+            break;
+        case MoveJournal::EntryType::STACK_DRAW:
+            success = cardController.handleStackCardClick(entry.cardId1);
+            break;
+        case MoveJournal::EntryType::UNDO:
+            success = undoManager.undo();
+            break;
+        case MoveJournal::EntryType::REDO:
+            success = undoManager.redo();
+            break;
         }
         
-        // 自动弹栈：将备用牌堆的第一张牌弹到底牌堆（这是游戏规则，不记录到回退栈）
-        if (!_gameModel->isStackPileEmpty()) {
-            int firstStackCard = _gameModel->popFromStackPile();
-            _gameModel->pushToBottomPile(firstStackCard);
-            _gameModel->setTopCard(firstStackCard);
+        // 日志与关卡不一致时只保留能回放的前缀
+        if (!success) {
+            CCLOGERROR("Journal replay stopped at entry %d (type %d)", (int)i, (int)entry.type);
+            break;
         }
+        replayed++;
+    }
+    return replayed;
+}
+
+} // namespace
+
+bool GameController::resumeFromJournal() {
+    MoveJournal::Contents journal;
+    if (!MoveJournal::load(MoveJournal::getDefaultPath(), journal)) {
+        return false;
+    }
+    
+    if (!_cardController) {
+        return false;
+    }
+    
+    CCLOG("Resuming level %d from journal, %d entries", journal.levelId, (int)journal.entries.size());
+    
+    // 在独立的模型上建好关卡：依赖图不依赖视图，直接按模型坐标构建
+    auto gameModel = std::make_unique<GameModel>();
+    auto undoManager = std::make_unique<UndoManager>();
+    undoManager->init(gameModel.get());
+    bool loadedFromJson = false;
+    if (!loadLevelFromConfig(journal.levelId, *gameModel, loadedFromJson)) {
+        gameModel->buildDependencyGraphFromPositions(CardView::getCardSize());
+    }
+    gameModel->setGameState(GameModel::GameState::PLAYING);
+    
+    // 先回放全部记录，全部成功才替换当前对局。
+    // 回放时不写日志：失败时磁盘上的日志保持原样；视图随后按回放结果整体创建，回放期间不产生变更事件
+    NullGameView replayView;
+    gameModel->setChangeEventsEnabled(false);
+    _cardController->setMoveJournal(nullptr);
+    _cardController->init(gameModel.get(), &replayView, undoManager.get());
+    int replayed = replayJournalEntries(*_cardController, *undoManager, journal.entries, 0);
+    _cardController->setMoveJournal(_moveJournal.get());
+    gameModel->setChangeEventsEnabled(true);
+    _cardController->init(_gameModel.get(), _gameView, _undoManager.get());
+    
+    // 日志与关卡不一致（例如关卡文件已变化）时无法可靠重建对局，交给调用方重新开局
+    if (replayed != (int)journal.entries.size()) {
+        CCLOGERROR("Journal replay failed: %d/%d entries", replayed, (int)journal.entries.size());
+        return false;
+    }
+    
+    _currentLevelId = journal.levelId;
+    _gameModel = std::move(gameModel);
+    _undoManager = std::move(undoManager);
+    
+    // 接续原日志：全部记录都已回放，原样保留
+    if (_moveJournal) {
+        _moveJournal->resume(journal.levelId, journal.sessionId, journal.entries);
+    }
+    
+    // 依赖图已在回放前构建，不再根据视图重建
+    if (_gameView) {
+        _gameView->initializeWithModel(*_gameModel, false);
+    }
+    
+    _cardController->init(_gameModel.get(), _gameView, _undoManager.get());
+    if (_undoController) {
+        _undoController->init(_gameModel.get(), _gameView, _undoManager.get());
+    }
+    
+    preloadNextLevel();
+    watchLevelFile(loadedFromJson);
+    
+    CCLOG("Journal replay completed: %d entries", replayed);
+    return true;
+}
+
+bool GameController::resumeFromSnapshot() {
+    const std::string snapshotPath = GameSnapshotService::getDefaultPath();
+    if (!FileUtils::getInstance()->isFileExist(snapshotPath)) {
+        return false;
+    }
+    
+    // 存档只有在日志仍属于同一局时才有效，存档之后的操作由日志补上
+    MoveJournal::Contents journal;
+    if (!MoveJournal::load(MoveJournal::getDefaultPath(), journal)) {
+        return false;
+    }
+    
+    Data data = FileUtils::getInstance()->getDataFromFile(snapshotPath);
+    if (data.isNull()) {
+        return false;
+    }
+    
+    auto gameModel = std::make_unique<GameModel>();
+    auto undoManager = std::make_unique<UndoManager>();
+    undoManager->init(gameModel.get());
+    
+    GameSnapshotService::SnapshotInfo info;
+    if (!GameSnapshotService::deserialize(data.getBytes(), (size_t)data.getSize(),
+                                          *gameModel, undoManager->getUndoModel(), info)) {
+        return false;
+    }
+    
+    if (info.sessionId != journal.sessionId || info.levelId != journal.levelId ||
+        info.journalEntryCount > journal.entries.size()) {
+        CCLOG("Snapshot does not match journal session, ignoring it");
+        return false;
     }
+    
+    if (!_cardController) {
+        return false;
+    }
+    
+    int remaining = (int)(journal.entries.size() - info.journalEntryCount);
+    CCLOG("Resuming level %d from snapshot, replaying %d journal entries after it", info.levelId, remaining);
+    
+    // 先在存档模型上回放之后的记录，全部成功才替换当前对局。
+    // 回放时不写日志：失败时磁盘上的日志保持原样，调用方仍可改为从日志恢复
+    // 视图随后按回放结果整体创建，回放期间不产生变更事件
+    NullGameView replayView;
+    gameModel->setChangeEventsEnabled(false);
+    _cardController->setMoveJournal(nullptr);
+    _cardController->init(gameModel.get(), &replayView, undoManager.get());
+    int replayed = replayJournalEntries(*_cardController, *undoManager, journal.entries, info.journalEntryCount);
+    _cardController->setMoveJournal(_moveJournal.get());
+    gameModel->setChangeEventsEnabled(true);
+    _cardController->init(_gameModel.get(), _gameView, _undoManager.get());
+    
+    if (replayed != remaining) {
+        CCLOGERROR("Snapshot replay failed: %d/%d journal entries, ignoring snapshot", replayed, remaining);
+        return false;
+    }
+    
+    _currentLevelId = info.levelId;
+    _gameModel = std::move(gameModel);
+    _undoManager = std::move(undoManager);
+    
+    // 接续原日志：全部记录都已回放，原样保留
+    if (_moveJournal) {
+        _moveJournal->resume(info.levelId, info.sessionId, journal.entries);
+    }
+    
+    // 依赖图已随存档载入，不再根据视图重建
+    if (_gameView) {
+        _gameView->initializeWithModel(*_gameModel, false);
+    }
+    
+    _cardController->init(_gameModel.get(), _gameView, _undoManager.get());
+    if (_undoController) {
+        _undoController->init(_gameModel.get(), _gameView, _undoManager.get());
+    }
+    
+    preloadNextLevel();
+    
+    return true;
+}
+
+bool GameController::saveSnapshot() {
+    if (!_gameModel || !_undoManager || !_moveJournal) {
+        return false;
+    }
+    
+    // 已结束的对局不再存档
+    if (_gameModel->getGameState() == GameModel::GameState::VICTORY) {
+        return false;
+    }
+    
+    GameSnapshotService::SnapshotInfo info;
+    info.levelId = _currentLevelId;
+    info.sessionId = _moveJournal->getSessionId();
+    info.journalEntryCount = (uint32_t)_moveJournal->getEntryCount();
+    
+    std::vector<unsigned char> buffer;
+    GameSnapshotService::serialize(*_gameModel, _undoManager->getUndoModel(), info, buffer);
+    
+    // 存档依赖日志中对应的记录，一并请求写盘
+    _moveJournal->flush();
+    
+    return GameSnapshotService::writeToFile(buffer, GameSnapshotService::getDefaultPath());
+}
+
+void GameController::applyLevelHotReload(const LevelConfig& config, const std::vector<size_t>& changedPlayfield,
+                                         const std::vector<size_t>& changedStack, bool structural) {
+    if (!_gameModel) return;
+    
+    // 卡牌数量变化后卡牌ID整体错位，只能重开（配置缓存已由热重载器更新）
+    if (structural) {
+        CCLOG("Level %d layout changed structurally, restarting level", _currentLevelId);
+        startGame(_currentLevelId);
+        return;
+    }
+    
+    const int firstCardId = GameModelFromLevelGenerator::FIRST_CARD_ID;
+    const int playfieldCount = (int)config.playfieldCards.size();
+    std::vector<int> changedCardIds;
+    
+    auto patchCard = [this, &changedCardIds](int cardId, const LevelConfig::CardConfig& cardConfig) {
+        CardModel* card = _gameModel->getCard(cardId);
+        if (!card) return;
+        card->setFace(cardConfig.face);
+        card->setSuit(cardConfig.suit);
+        card->setPosition(cardConfig.position);
+        card->setCovered(cardConfig.isCovered);   // 翻面状态由随后的视图刷新体现
+        changedCardIds.push_back(cardId);
+    };
+    
+    for (size_t index : changedPlayfield) {
+        patchCard(firstCardId + (int)index, config.playfieldCards[index]);
+    }
+    std::vector<int> changedPlayfieldIds = changedCardIds;
+    
+    for (size_t index : changedStack) {
+        patchCard(firstCardId + playfieldCount + (int)index, config.stackCards[index]);
+    }
+    
+    // 只重算与变化卡牌相关的覆盖关系
+    if (!changedPlayfieldIds.empty()) {
+        std::vector<int> placementOrder;
+        placementOrder.reserve(playfieldCount);
+        for (int i = 0; i < playfieldCount; ++i) {
+            placementOrder.push_back(firstCardId + i);
+        }
+        _gameModel->updateDependencies(changedPlayfieldIds, placementOrder, CardView::getCardSize());
+    }
+    
+    if (_gameView) {
+        // 卡牌位置配置可能变化，先重算位置表
+        _gameView->rebuildBoardLayout();
+        for (int cardId : changedCardIds) {
+            _gameView->updateCardView(cardId);
+        }
+    }
+    
+    CCLOG("Hot reload patched %d cards of level %d", (int)changedCardIds.size(), _currentLevelId);
+}
+
+bool GameController::loadLevelFromConfig(int levelId, GameModel& gameModel, bool& loadedFromJson) {
+    bool dependencyGraphReady = false;
+    
+    // 优先使用后台预加载好的模型和覆盖关系，关卡切换时主线程无需读取、解析配置或构建依赖图
+    if (_levelPreloader && _levelPreloader->takePreloaded(levelId, gameModel, dependencyGraphReady, loadedFromJson)) {
+        return dependencyGraphReady;
+    }
+    
+    gameModel = GameModelFromLevelGenerator::generateGameModelForLevel(levelId, CardView::getCardSize(),
+                                                                         dependencyGraphReady);
+    loadedFromJson = !dependencyGraphReady;
+    return dependencyGraphReady;
 }
 
 void GameController::handleCardClick(int cardId) {
-    // 检查是否有动画正在播放
-    if (_isAnimationPlaying) {
+    // 本关已完成，等待切换到下一关
+    if (_gameModel && _gameModel->getGameState() == GameModel::GameState::VICTORY) {
+        CCLOG("Card click ignored - level completed");
+        return;
+    }
+    
+    // 检查是否有动画正在播放（包括回退/重做动画）
+    if (_isAnimationPlaying || (_undoController && _undoController->isAnimationPlaying())) {
         CCLOG("Card click ignored - animation is playing");
         return;
     }
@@ -156,6 +450,11 @@ void GameController::handleCardClick(int cardId) {
 
 
 void GameController::handleUndo() {
+    // 关卡已完成，日志已结束，不再回退
+    if (_gameModel && _gameModel->getGameState() == GameModel::GameState::VICTORY) {
+        return;
+    }
+    
     // 检查时间锁
     if (!canUndo()) {
         CCLOG("Undo ignored - cooldown time not reached");
@@ -170,20 +469,7 @@ void GameController::handleUndo() {
     if (!_undoController->canUndo()) {
         // 显示提示信息
         if (_gameView) {
-            auto message = Label::createWithTTF("No moves to undo", "fonts/arial.ttf", 16);
-            message->setPosition(Vec2(1000, 250));
-            message->setColor(Color3B::RED);
-            _gameView->addChild(message, 100);
-            
-            // 2秒后移除提示
-            auto removeAction = Sequence::create(
-                DelayTime::create(2.0f),
-                CallFunc::create([message]() {
-                    message->removeFromParent();
-                }),
-                nullptr
-            );
-            message->runAction(removeAction);
+            _gameView->showToast("No moves to undo", Vec2(1000, 250), Color3B::RED);
         }
         return;
     }
@@ -196,6 +482,40 @@ void GameController::handleUndo() {
 }
 
 
+void GameController::handleRedo() {
+    // 重做与回退共用同一个时间锁
+    if (!canUndo()) {
+        CCLOG("Redo ignored - cooldown time not reached");
+        return;
+    }
+    
+    if (!_undoController) {
+        CCLOGERROR("UndoController is null");
+        return;
+    }
+
+    // 重做会移动卡牌，任何动画（包括回退动画）进行中都不响应
+    if (_isAnimationPlaying || _undoController->isAnimationPlaying()) {
+        CCLOG("Redo ignored - animation is playing");
+        return;
+    }
+
+    if (!_undoController->canRedo()) {
+        CCLOG("No moves to redo");
+        return;
+    }
+
+    // 设置时间锁
+    setUndoCooldown();
+    
+    // 委托给UndoController执行重做操作；动画期间整个控制器进入动画状态，
+    // 移动到顶部的动画完成后由GameView统一重置
+    if (_undoController->executeRedo() && _undoController->isAnimationPlaying()) {
+        setAnimationPlaying(true);
+    }
+}
+
+
 void GameController::setupSubControllers() {
     // 初始化卡片控制器
     if (_cardController && _gameModel && _gameView && _undoManager) {
@@ -210,6 +530,14 @@ void GameController::setupSubControllers() {
     } else {
         CCLOGERROR("Failed to initialize UndoController - missing dependencies");
     }
+    
+    // 子控制器在操作发生处写入日志
+    if (_cardController) {
+        _cardController->setMoveJournal(_moveJournal.get());
+    }
+    if (_undoController) {
+        _undoController->setMoveJournal(_moveJournal.get());
+    }
 }
 
 void GameController::setupViewCallbacks() {
@@ -232,12 +560,56 @@ void GameController::setAnimationPlaying(bool playing) {
     CCLOG("GameController animation state set to: %s", playing ? "true" : "false");
 }
 
+void GameController::onMoveAnimationCompleted() {
+    setAnimationPlaying(false);
+    
+    if (_gameModel && _gameModel->getGameState() == GameModel::GameState::PLAYING &&
+        _gameModel->getPlayfieldCardIds().empty()) {
+        handleLevelCompleted();
+    }
+}
+
+void GameController::handleLevelCompleted() {
+    CCLOG("Level %d completed in %d moves", _currentLevelId, _gameModel->getMoveCount());
+    _gameModel->setGameState(GameModel::GameState::VICTORY);
+    
+    if (_moveJournal) {
+        _moveJournal->finish();
+    }
+    
+    const std::string snapshotPath = GameSnapshotService::getDefaultPath();
+    if (FileUtils::getInstance()->isFileExist(snapshotPath)) {
+        FileUtils::getInstance()->removeFile(snapshotPath);
+    }
+    
+    if (_gameView) {
+        _gameView->showToast("Level complete", Vec2(1000, 250), Color3B::GREEN);
+    }
+    scheduleNextLevel();
+}
+
+void GameController::scheduleNextLevel() {
+    // 切换放到帧回调中：当前调用栈还在补间完成回调里，不能在这里回收卡牌视图。
+    // 下一关仍在后台准备时每帧检查一次，不阻塞主线程
+    Scheduler* scheduler = Director::getInstance()->getScheduler();
+    scheduler->schedule([this](float) {
+        if (_levelPreloader && _levelPreloader->isLoading(_currentLevelId + 1)) {
+            return;
+        }
+        
+        Director::getInstance()->getScheduler()->unschedule(NEXT_LEVEL_SCHEDULE_KEY, this);
+        if (!startNextLevel()) {
+            CCLOG("No level after %d, staying on the completed board", _currentLevelId);
+        }
+    }, this, 0.0f, false, NEXT_LEVEL_SCHEDULE_KEY);
+}
+
 bool GameController::canUndo() const {
-    float currentTime = Director::getInstance()->getTotalFrames() * Director::getInstance()->getAnimationInterval();
-    return (currentTime - _lastUndoTime) >= UNDO_COOLDOWN_TIME;
+    // 冷却按模拟时间计，随游戏倍速缩放
+    return GameClock::hasElapsed(_lastUndoTime, UNDO_COOLDOWN_TIME);
 }
 
 void GameController::setUndoCooldown() {
-    _lastUndoTime = Director::getInstance()->getTotalFrames() * Director::getInstance()->getAnimationInterval();
+    _lastUndoTime = GameClock::getTime();
     CCLOG("Undo cooldown set, next undo available in %.1f seconds", UNDO_COOLDOWN_TIME);
 }
\ No newline at end of file
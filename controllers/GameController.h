@@ -9,6 +9,10 @@ class GameModel;
 class UndoManager;
 class CardController;
 class UndoController;
+class MoveJournal;
+class LevelPreloader;
+class LevelHotReloader;
+class LevelConfig;
 
 class GameController {
 public:
@@ -17,8 +21,21 @@ public:
 
     bool init();
     void startGame(int levelId);
+    
+    // 进入下一关（使用后台预加载的数据），下一关不存在或尚未准备好时返回false
+    bool startNextLevel();
+    
+    // 从操作日志恢复上次未完成的对局，没有可用日志时返回false
+    bool resumeFromJournal();
+    
+    // 从二进制存档快速恢复对局，存档缺失或与日志不属于同一局时返回false
+    bool resumeFromSnapshot();
+    
+    // 将当前对局写入二进制存档
+    bool saveSnapshot();
     void handleCardClick(int cardId);
     void handleUndo();
+    void handleRedo();
 
     // 获取游戏视图
     GameView* getView() const { return _gameView; }
@@ -30,6 +47,9 @@ public:
     bool isAnimationPlaying() const { return _isAnimationPlaying; }
     void setAnimationPlaying(bool playing);
     
+    // 卡牌移动到底牌堆的动画完成：重置动画状态，主牌堆清空时结束本关
+    void onMoveAnimationCompleted();
+    
     // 回退按钮时间锁管理
     bool canUndo() const;
     void setUndoCooldown();
@@ -37,7 +57,20 @@ public:
 private:
     void setupSubControllers();
     void setupViewCallbacks();
-    void loadLevelFromConfig(int levelId);
+    // 加载关卡到指定模型，返回依赖图是否已填充（预编译关卡或后台预加载的关卡）
+    // loadedFromJson输出关卡是否来自JSON源文件
+    bool loadLevelFromConfig(int levelId, GameModel& gameModel, bool& loadedFromJson);
+    // 在后台预加载下一关
+    void preloadNextLevel();
+    // 调试版本中监视当前关卡的JSON文件（预编译关卡不监视）
+    void watchLevelFile(bool loadedFromJson);
+    // 关卡完成：结束操作日志并删除存档，下次启动不再恢复已结束的对局，随后进入下一关
+    void handleLevelCompleted();
+    // 在之后的帧中进入下一关（等待后台预加载完成）
+    void scheduleNextLevel();
+    // 关卡文件热重载：只修补变化的卡牌，卡牌数量变化时重开关卡
+    void applyLevelHotReload(const LevelConfig& config, const std::vector<size_t>& changedPlayfield,
+                             const std::vector<size_t>& changedStack, bool structural);
 
     std::unique_ptr<GameModel> _gameModel;
     GameView* _gameView;
@@ -50,15 +83,25 @@ private:
     
     // 撤销管理器
     std::unique_ptr<UndoManager> _undoManager;
+    
+    // 操作日志 - 用于崩溃后恢复对局
+    std::unique_ptr<MoveJournal> _moveJournal;
+    
+    // 关卡预加载器 - 后台准备下一关
+    std::unique_ptr<LevelPreloader> _levelPreloader;
+    
+    // 关卡热重载 - 开发时监视关卡文件变化
+    std::unique_ptr<LevelHotReloader> _levelHotReloader;
 
     int _currentLevelId;
     
     // 动画状态管理
     bool _isAnimationPlaying;
     
-    // 回退按钮时间锁
-    float _lastUndoTime;
+    // 回退按钮时间锁（GameClock模拟时间）
+    double _lastUndoTime;
     static const float UNDO_COOLDOWN_TIME;
+    static const char* const NEXT_LEVEL_SCHEDULE_KEY;
 };
 
 #endif // __GAME_CONTROLLER_H__
\ No newline at end of file
@@ -1,9 +1,10 @@
 #include "UndoController.h"
 #include "../models/GameModel.h"
-#include "../views/GameView.h"
+#include "../views/GameViewInterface.h"
 #include "../managers/UndoManager.h"
-#include "../utils/GameUtils.h"
+#include "../managers/MoveJournal.h"
 #include "cocos2d.h"
+#include <algorithm>
 
 USING_NS_CC;
 
@@ -11,16 +12,24 @@ UndoController::UndoController()
     : _gameModel(nullptr)
     , _gameView(nullptr)
     , _undoManager(nullptr)
+    , _moveJournal(nullptr)
     , _isAnimationPlaying(false) {
 }
 
 UndoController::~UndoController() {
 }
 
-void UndoController::init(GameModel* gameModel, GameView* gameView, UndoManager* undoManager) {
+void UndoController::init(GameModel* gameModel, GameViewInterface* gameView, UndoManager* undoManager) {
     _gameModel = gameModel;
     _gameView = gameView;
     _undoManager = undoManager;
+    
+    // 回退动画由视图按帧分批完成，每批完成后检查是否全部结束
+    if (_gameView) {
+        _gameView->setReturnAnimationsCompletedCallback([this]() {
+            checkAndCompleteUndo();
+        });
+    }
 }
 
 bool UndoController::executeUndo() {
@@ -34,7 +43,7 @@ bool UndoController::executeUndo() {
     }
     
     // 获取被回退影响的卡牌ID列表（在回退前记录）
-    std::vector<int> affectedCardIds = getAffectedCardIds();
+    collectAffectedCardIds(_affectedCardIds);
     
     // 执行回退操作
     bool success = _undoManager->undo();
@@ -43,14 +52,23 @@ bool UndoController::executeUndo() {
         return false;
     }
     
+    if (_moveJournal) {
+        _moveJournal->append(MoveJournal::EntryType::UNDO);
+    }
+    
     // 设置动画状态
     setAnimationPlaying(true);
     
     // 只播放被影响卡牌的回退动画
-    playUndoAnimations(affectedCardIds);
+    int animatedCount = playUndoAnimations(_affectedCardIds);
     
     // 更新被影响的卡牌视图
-    updateAffectedCardViews(affectedCardIds);
+    updateAffectedCardViews(_affectedCardIds);
+    
+    // 没有卡牌需要移动时不会有完成回调，直接结束回退
+    if (animatedCount == 0) {
+        checkAndCompleteUndo();
+    }
     
     // 注意：restoreAllCardZOrders 应该在动画完成后调用，而不是在动画开始前
     // 这里先不调用，让动画自己处理层级设置
@@ -68,24 +86,57 @@ bool UndoController::canUndo() const {
     return _undoManager->canUndo();
 }
 
-void UndoController::playUndoAnimations(const std::vector<int>& affectedCardIds) {
+bool UndoController::executeRedo() {
+    if (!_gameModel || !_gameView || !_undoManager) {
+        CCLOGERROR("UndoController not properly initialized");
+        return false;
+    }
+    
+    const UndoStep* step = _undoManager->peekRedoStep();
+    if (!step) {
+        return false;
+    }
+    
+    // 重做的两种操作都会把cardId1移动到底牌堆顶部
+    int cardId = step->cardId1;
+    
+    bool success = _undoManager->redo();
+    if (!success) {
+        CCLOGERROR("Redo operation failed");
+        return false;
+    }
+    
+    if (_moveJournal) {
+        _moveJournal->append(MoveJournal::EntryType::REDO);
+    }
+    
+    // 设置动画状态，动画完成回调会通过GameController重置
+    CardModel* cardModel = _gameModel->getCard(cardId);
+    Vec2 originalPosition = cardModel ? cardModel->getPosition() : Vec2::ZERO;
+    setAnimationPlaying(_gameView->playCardMoveToTopAnimation(cardId, originalPosition));
+    
+    return true;
+}
+
+bool UndoController::canRedo() const {
+    if (!_undoManager) {
+        return false;
+    }
+    return _undoManager->canRedo();
+}
+
+int UndoController::playUndoAnimations(const std::vector<int>& affectedCardIds) {
     CCLOG("UndoController::playUndoAnimations - Playing animations for %d affected cards", (int)affectedCardIds.size());
     
     if (!_gameView || !_gameModel) {
         CCLOGERROR("GameView or GameModel is null, cannot play undo animations");
-        return;
+        return 0;
     }
     
     int animatedCount = 0;
     
     // 只对被影响的卡牌播放动画
     for (int cardId : affectedCardIds) {
-        CardView* cardView = _gameView->getCardView(cardId);
-        if (!cardView) {
-            CCLOG("CardView not found for card %d, skipping animation", cardId);
-            continue;
-        }
-        
         CardModel* cardModel = _gameModel->getCard(cardId);
         if (!cardModel) {
             CCLOG("CardModel not found for card %d, skipping animation", cardId);
@@ -99,59 +150,21 @@ void UndoController::playUndoAnimations(const std::vector<int>& affectedCardIds)
             continue;
         }
         
-        // 使用工具类计算目标位置
-        Vec2 modelPos = GameUtils::calculateTargetPosition(cardModel, cardId);
-        Vec2 viewPos = cardView->getPosition();
-        
-        // 只有当视图位置与模型位置不同时才播放动画
-        if (viewPos != modelPos) {
-            CCLOG("Card %d needs animation: view(%.1f,%.1f) -> model(%.1f,%.1f)", 
-                  cardId, viewPos.x, viewPos.y, modelPos.x, modelPos.y);
-            
-            // 设置移动中的卡牌为最高层级
-            cardView->setZOrder(GameUtils::MOVING_CARD_ZORDER);
-            CCLOG("Card %d set to moving zOrder=%d for undo animation", cardId, GameUtils::MOVING_CARD_ZORDER);
-            
-            // 创建移动动画
-            auto moveAction = MoveTo::create(GameUtils::ANIMATION_DURATION, modelPos);
-            auto easeAction = EaseInOut::create(moveAction, 2.0f);
-            
-            // 创建缩放动画
-            auto scaleUp = ScaleTo::create(GameUtils::SCALE_ANIMATION_DURATION, GameUtils::CARD_SCALE_FACTOR);
-            auto scaleDown = ScaleTo::create(GameUtils::SCALE_ANIMATION_DURATION, 1.0f);
-            auto scaleSequence = Sequence::create(scaleUp, scaleDown, nullptr);
-            
-            // 组合移动和缩放动画
-            auto spawnAction = Spawn::create(easeAction, scaleSequence, nullptr);
-            
-            // 动画完成后设置最终位置和正确的层级
-            auto finalizeAction = CallFunc::create([cardView, modelPos, cardId, this]() {
-                cardView->setPosition(modelPos);
-                
-                // 使用工具类计算正确的层级
-                int correctZOrder = GameUtils::calculateCorrectZOrder(cardId, this->_gameModel);
-                cardView->setZOrder(correctZOrder);
-                CCLOG("Card %d undo animation completed with zOrder=%d", cardId, correctZOrder);
-                
-                // 检查是否所有动画都完成了
-                this->checkAndCompleteUndo();
-            });
-            
-            auto completeAction = Sequence::create(spawnAction, finalizeAction, nullptr);
-            cardView->runAction(completeAction);
-            
+        // 视图只在位置与模型不一致时播放动画
+        if (_gameView->playCardReturnAnimation(cardId)) {
             animatedCount++;
         }
     }
     
     CCLOG("UndoController::playUndoAnimations - Animated %d cards", animatedCount);
+    return animatedCount;
 }
 
-std::vector<int> UndoController::getAffectedCardIds() {
-    std::vector<int> affectedCardIds;
+void UndoController::collectAffectedCardIds(std::vector<int>& affectedCardIds) {
+    affectedCardIds.clear();
     
     if (!_gameModel || !_gameView) {
-        return affectedCardIds;
+        return;
     }
     
     // 只获取备用牌堆和主牌堆的卡牌ID
@@ -169,9 +182,7 @@ std::vector<int> UndoController::getAffectedCardIds() {
         affectedCardIds.push_back(cardId);
     }
     
-    CCLOG("UndoController::getAffectedCardIds - Found %d affected cards (excluding bottom pile)", (int)affectedCardIds.size());
-    
-    return affectedCardIds;
+    CCLOG("UndoController::collectAffectedCardIds - Found %d affected cards (excluding bottom pile)", (int)affectedCardIds.size());
 }
 
 void UndoController::updateAffectedCardViews(const std::vector<int>& affectedCardIds) {
@@ -183,28 +194,20 @@ void UndoController::updateAffectedCardViews(const std::vector<int>& affectedCar
     }
     
     // 只更新被影响的卡牌视图
+    const auto& bottomCardIds = _gameModel->getBottomCardIds();
     for (int cardId : affectedCardIds) {
-        CardView* cardView = _gameView->getCardView(cardId);
-        if (cardView) {
-            // 额外检查：确保不是底牌堆的卡牌
-            const auto& bottomCardIds = _gameModel->getBottomCardIds();
-            if (std::find(bottomCardIds.begin(), bottomCardIds.end(), cardId) != bottomCardIds.end()) {
-                CCLOG("Skipping bottom pile card %d (should not be updated)", cardId);
-                continue;
-            }
-            
-            cardView->updateDisplay();
-            CCLOG("Updated card view for card %d", cardId);
+        // 额外检查：确保不是底牌堆的卡牌
+        if (std::find(bottomCardIds.begin(), bottomCardIds.end(), cardId) != bottomCardIds.end()) {
+            CCLOG("Skipping bottom pile card %d (should not be updated)", cardId);
+            continue;
         }
+        
+        _gameView->refreshCardDisplay(cardId);
     }
     
     CCLOG("UndoController::updateAffectedCardViews - Updated %d card views", (int)affectedCardIds.size());
 }
 
-int UndoController::calculateCorrectZOrder(int cardId) {
-    return GameUtils::calculateCorrectZOrder(cardId, _gameModel);
-}
-
 void UndoController::restoreAllCardZOrders() {
     CCLOG("UndoController::restoreAllCardZOrders - Restoring all card z-orders");
     
@@ -213,28 +216,8 @@ void UndoController::restoreAllCardZOrders() {
         return;
     }
     
-    int restoredCount = 0;
-    
     // 遍历所有卡牌视图，恢复正确的层级关系
-    for (auto& pair : _gameView->getCardViews()) {
-        if (pair.second) {
-            CardView* cardView = pair.second.get();
-            if (cardView && cardView->getParent()) {
-                int cardId = pair.first;
-                
-                // 计算正确的层级
-                int correctZOrder = calculateCorrectZOrder(cardId);
-                
-                // 设置正确的层级
-                cardView->setZOrder(correctZOrder);
-                
-                CCLOG("Restored card %d zOrder to %d", cardId, correctZOrder);
-                restoredCount++;
-            }
-        }
-    }
-    
-    CCLOG("UndoController::restoreAllCardZOrders - Restored %d card z-orders", restoredCount);
+    _gameView->restoreCardZOrders();
 }
 
 void UndoController::setAnimationPlaying(bool playing) {
@@ -246,17 +229,9 @@ bool UndoController::isAnimationPlaying() const {
 }
 
 void UndoController::checkAndCompleteUndo() {
-    // 检查是否还有动画正在播放
+    // 检查是否还有回退动画正在播放
     if (_gameView) {
-        bool hasRunningAnimations = false;
-        for (auto& pair : _gameView->getCardViews()) {
-            if (pair.second && pair.second->getNumberOfRunningActions() > 0) {
-                hasRunningAnimations = true;
-                break;
-            }
-        }
-        
-        if (!hasRunningAnimations) {
+        if (!_gameView->isPlayingReturnAnimations()) {
             // 所有动画都完成了，恢复所有卡牌的正确层级关系
             restoreAllCardZOrders();
             
@@ -5,8 +5,9 @@
 
 // 前向声明
 class GameModel;
-class GameView;
+class GameViewInterface;
 class UndoManager;
+class MoveJournal;
 
 /**
  * @class UndoController
@@ -26,10 +27,16 @@ public:
     /**
      * @brief 初始化控制器
      * @param gameModel 游戏模型
-     * @param gameView 游戏视图
+     * @param gameView 游戏视图接口
      * @param undoManager 回退管理器
      */
-    void init(GameModel* gameModel, GameView* gameView, UndoManager* undoManager);
+    void init(GameModel* gameModel, GameViewInterface* gameView, UndoManager* undoManager);
+    
+    /**
+     * @brief 设置操作日志
+     * @param moveJournal 操作日志
+     */
+    void setMoveJournal(MoveJournal* moveJournal) { _moveJournal = moveJournal; }
     
     /**
      * @brief 执行回退操作
@@ -43,6 +50,18 @@ public:
      */
     bool canUndo() const;
     
+    /**
+     * @brief 执行重做操作（重新应用最近一次被回退的步骤）
+     * @return 是否重做成功
+     */
+    bool executeRedo();
+    
+    /**
+     * @brief 检查是否可以重做
+     * @return 是否可以重做
+     */
+    bool canRedo() const;
+    
     /**
      * @brief 设置动画播放状态
      * @param playing 是否正在播放动画
@@ -57,20 +76,22 @@ public:
 
 private:
     GameModel* _gameModel;
-    GameView* _gameView;
+    GameViewInterface* _gameView;
     UndoManager* _undoManager;
+    MoveJournal* _moveJournal;
     
     /**
      * @brief 播放回退动画（只针对被回退的卡牌）
      * @param affectedCardIds 被回退影响的卡牌ID列表
+     * @return 实际开始播放动画的卡牌数量
      */
-    void playUndoAnimations(const std::vector<int>& affectedCardIds);
+    int playUndoAnimations(const std::vector<int>& affectedCardIds);
     
     /**
-     * @brief 获取被回退影响的卡牌ID列表
-     * @return 被影响的卡牌ID列表
+     * @brief 收集被回退影响的卡牌ID列表（复用调用方的容器，稳定后不再分配内存）
+     * @param affectedCardIds 输出：被影响的卡牌ID列表
      */
-    std::vector<int> getAffectedCardIds();
+    void collectAffectedCardIds(std::vector<int>& affectedCardIds);
     
     /**
      * @brief 更新卡牌视图（只更新被影响的卡牌）
@@ -78,13 +99,6 @@ private:
      */
     void updateAffectedCardViews(const std::vector<int>& affectedCardIds);
     
-    /**
-     * @brief 计算卡牌的正确层级
-     * @param cardId 卡牌ID
-     * @return 正确的zOrder值
-     */
-    int calculateCorrectZOrder(int cardId);
-    
     /**
      * @brief 恢复所有卡牌的正确层级关系
      */
@@ -98,6 +112,9 @@ private:
 private:
     // 动画状态管理
     bool _isAnimationPlaying;
+    
+    // 每次回退复用的受影响卡牌列表
+    std::vector<int> _affectedCardIds;
 };
 
 #endif // __UNDO_CONTROLLER_H__
@@ -0,0 +1,114 @@
+#include "IdleFrameThrottle.h"
+#include <utility>
+#include <vector>
+
+USING_NS_CC;
+
+const float IdleFrameThrottle::IDLE_INTERVAL = 0.25f;
+const int IdleFrameThrottle::QUIET_FRAMES_BEFORE_IDLE = 30;
+
+namespace {
+
+const char* const SCHEDULE_KEY = "idle_frame_throttle";
+
+struct ThrottleState {
+    bool installed = false;
+    bool idle = false;
+    float activeInterval = 1.0f / 60.0f;
+    int quietFrames = 0;
+    int nextHandle = 1;
+    std::vector<std::pair<int, IdleFrameThrottle::BusyCheck>> busyChecks;
+};
+
+ThrottleState& getState() {
+    static ThrottleState state;
+    return state;
+}
+
+bool isBusy() {
+    if (Director::getInstance()->getActionManager()->getNumberOfRunningActions() > 0) {
+        return true;
+    }
+
+    for (const auto& entry : getState().busyChecks) {
+        if (entry.second()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void tick(float /*dt*/) {
+    ThrottleState& state = getState();
+    if (isBusy()) {
+        state.quietFrames = 0;
+        if (state.idle) {
+            IdleFrameThrottle::wake();
+        }
+        return;
+    }
+
+    if (state.idle || ++state.quietFrames < IdleFrameThrottle::QUIET_FRAMES_BEFORE_IDLE) {
+        return;
+    }
+
+    state.idle = true;
+    Director::getInstance()->setAnimationInterval(IdleFrameThrottle::IDLE_INTERVAL);
+    CCLOG("IdleFrameThrottle: board static, frame interval -> %.2fs", IdleFrameThrottle::IDLE_INTERVAL);
+}
+
+} // namespace
+
+void IdleFrameThrottle::install(float activeInterval) {
+    ThrottleState& state = getState();
+    if (state.installed) {
+        return;
+    }
+    state.installed = true;
+    state.activeInterval = activeInterval;
+
+    Director* director = Director::getInstance();
+    director->getScheduler()->schedule(tick, &state, 0.0f, false, SCHEDULE_KEY);
+
+    // 最高优先级、不吞没的触摸监听：只负责唤醒，触摸照常分发给棋盘和按钮
+    auto touchListener = EventListenerTouchOneByOne::create();
+    touchListener->setSwallowTouches(false);
+    touchListener->onTouchBegan = [](Touch* /*touch*/, Event* /*event*/) -> bool {
+        IdleFrameThrottle::wake();
+        return false;
+    };
+    director->getEventDispatcher()->addEventListenerWithFixedPriority(touchListener, -1);
+}
+
+int IdleFrameThrottle::addBusyCheck(const BusyCheck& check) {
+    ThrottleState& state = getState();
+    int handle = state.nextHandle++;
+    state.busyChecks.emplace_back(handle, check);
+    return handle;
+}
+
+void IdleFrameThrottle::removeBusyCheck(int handle) {
+    auto& checks = getState().busyChecks;
+    for (auto it = checks.begin(); it != checks.end(); ++it) {
+        if (it->first == handle) {
+            checks.erase(it);
+            return;
+        }
+    }
+}
+
+void IdleFrameThrottle::wake() {
+    ThrottleState& state = getState();
+    state.quietFrames = 0;
+    if (!state.idle) {
+        return;
+    }
+
+    state.idle = false;
+    Director::getInstance()->setAnimationInterval(state.activeInterval);
+    CCLOG("IdleFrameThrottle: resumed, frame interval -> %.3fs", state.activeInterval);
+}
+
+bool IdleFrameThrottle::isIdle() {
+    return getState().idle;
+}
@@ -0,0 +1,46 @@
+#ifndef __IDLE_FRAME_THROTTLE_H__
+#define __IDLE_FRAME_THROTTLE_H__
+
+#include "cocos2d.h"
+#include <functional>
+
+/**
+ * @class IdleFrameThrottle
+ * @brief 空闲降帧
+ *
+ * 职责：
+ * - 每帧检查是否还有动作、补间或待同步的变更（由各模块注册忙碌检查）
+ * - 连续QUIET_FRAMES_BEFORE_IDLE帧都空闲后，把Director的帧间隔降到IDLE_INTERVAL
+ * - 任何触摸或忙碌检查返回true时立即恢复正常帧率
+ *
+ * 空闲时触摸最多延迟一个IDLE_INTERVAL才被处理。只能在主线程使用。
+ */
+class IdleFrameThrottle {
+public:
+    using BusyCheck = std::function<bool()>;
+
+    static const float IDLE_INTERVAL;
+    static const int QUIET_FRAMES_BEFORE_IDLE;
+
+    /**
+     * @brief 开始监视（在runWithScene之后调用一次）
+     * @param activeInterval 正常帧间隔（秒）
+     */
+    static void install(float activeInterval);
+
+    /**
+     * @brief 注册忙碌检查，返回true时保持正常帧率
+     * @return 注销用的句柄
+     */
+    static int addBusyCheck(const BusyCheck& check);
+    static void removeBusyCheck(int handle);
+
+    /**
+     * @brief 立即恢复正常帧率（例如回到前台时）
+     */
+    static void wake();
+
+    static bool isIdle();
+};
+
+#endif // __IDLE_FRAME_THROTTLE_H__
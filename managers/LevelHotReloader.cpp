@@ -0,0 +1,129 @@
+#include "LevelHotReloader.h"
+#include "../configs/loaders/LevelConfigLoader.h"
+#include "../configs/loaders/LevelConfigCache.h"
+#include <sys/stat.h>
+
+USING_NS_CC;
+
+const float LevelHotReloader::POLL_INTERVAL = 0.5f;
+
+namespace {
+
+const char* const SCHEDULE_KEY = "level_hot_reload";
+
+bool isSameCard(const LevelConfig::CardConfig& a, const LevelConfig::CardConfig& b) {
+    return a.face == b.face && a.suit == b.suit && a.position == b.position && a.isCovered == b.isCovered;
+}
+
+void diffCards(const std::vector<LevelConfig::CardConfig>& oldCards,
+               const std::vector<LevelConfig::CardConfig>& newCards,
+               std::vector<size_t>& changed) {
+    for (size_t i = 0; i < newCards.size(); ++i) {
+        if (!isSameCard(oldCards[i], newCards[i])) {
+            changed.push_back(i);
+        }
+    }
+}
+
+} // namespace
+
+LevelHotReloader::LevelHotReloader()
+    : _levelId(0)
+    , _modifiedTime(0)
+    , _scheduled(false) {
+}
+
+LevelHotReloader::~LevelHotReloader() {
+    stop();
+}
+
+void LevelHotReloader::watch(int levelId, const ReloadCallback& callback) {
+    // 同一关卡重开（包括热重载回调内的重开）时只刷新基准配置，不重复注册定时器
+    if (_scheduled && levelId == _levelId) {
+        _config = LevelConfigLoader::loadLevelConfig(levelId);
+        _callback = callback;
+        return;
+    }
+    
+    stop();
+
+    _fullPath = FileUtils::getInstance()->fullPathForFilename(LevelConfigLoader::getConfigPath(levelId));
+    if (_fullPath.empty() || !getModifiedTime(_fullPath, _modifiedTime)) {
+        // 资源不在普通文件系统中（例如打包在APK内），无法监视
+        return;
+    }
+
+    _levelId = levelId;
+    _config = LevelConfigLoader::loadLevelConfig(levelId);
+    _callback = callback;
+
+    Director::getInstance()->getScheduler()->schedule(
+        [this](float dt) { poll(dt); }, this, POLL_INTERVAL, false, SCHEDULE_KEY);
+    _scheduled = true;
+    CCLOG("LevelHotReloader: watching %s", _fullPath.c_str());
+}
+
+void LevelHotReloader::stop() {
+    if (_scheduled) {
+        Director::getInstance()->getScheduler()->unschedule(SCHEDULE_KEY, this);
+        _scheduled = false;
+    }
+    _callback = nullptr;
+}
+
+LevelHotReloader::Diff LevelHotReloader::diff(const LevelConfig& oldConfig, const LevelConfig& newConfig) {
+    Diff result;
+    if (oldConfig.playfieldCards.size() != newConfig.playfieldCards.size() ||
+        oldConfig.stackCards.size() != newConfig.stackCards.size()) {
+        result.structural = true;
+        return result;
+    }
+
+    diffCards(oldConfig.playfieldCards, newConfig.playfieldCards, result.changedPlayfield);
+    diffCards(oldConfig.stackCards, newConfig.stackCards, result.changedStack);
+    return result;
+}
+
+void LevelHotReloader::poll(float /*dt*/) {
+    time_t modifiedTime = 0;
+    if (!getModifiedTime(_fullPath, modifiedTime) || modifiedTime == _modifiedTime) {
+        return;
+    }
+    _modifiedTime = modifiedTime;
+
+    // 直接按路径读取，绕过配置缓存
+    LevelConfig config = LevelConfigLoader::loadLevelConfig(_fullPath);
+    if (config.playfieldCards.empty() && config.stackCards.empty()) {
+        // 编辑器可能正在写文件，等下次修改再试
+        CCLOG("LevelHotReloader: %s is not loadable yet", _fullPath.c_str());
+        return;
+    }
+    config.levelId = _levelId;
+
+    Diff changes = diff(_config, config);
+    _config = config;
+    LevelConfigCache::put(_levelId, config);
+
+    if (changes.empty()) {
+        return;
+    }
+
+    CCLOG("LevelHotReloader: level %d changed (%s, %d playfield, %d stack cards)", _levelId,
+          changes.structural ? "structural" : "incremental",
+          (int)changes.changedPlayfield.size(), (int)changes.changedStack.size());
+
+    if (_callback) {
+        // 回调可能会重新调用watch，先拷贝一份
+        ReloadCallback callback = _callback;
+        callback(config, changes);
+    }
+}
+
+bool LevelHotReloader::getModifiedTime(const std::string& fullPath, time_t& modifiedTime) {
+    struct stat fileStat;
+    if (stat(fullPath.c_str(), &fileStat) != 0) {
+        return false;
+    }
+    modifiedTime = fileStat.st_mtime;
+    return true;
+}
\ No newline at end of file
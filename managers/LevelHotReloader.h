@@ -0,0 +1,71 @@
+#ifndef __LEVEL_HOT_RELOADER_H__
+#define __LEVEL_HOT_RELOADER_H__
+
+#include "cocos2d.h"
+#include "../configs/models/LevelConfig.h"
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @class LevelHotReloader
+ * @brief 关卡文件热重载（开发用）
+ * 
+ * 职责：
+ * - 定时检查当前关卡JSON文件的修改时间
+ * - 文件变化后重新解析，并与正在运行的配置逐卡对比
+ * - 把差异交给回调，由控制器只修补变化的卡牌
+ */
+class LevelHotReloader {
+public:
+    /**
+     * @struct Diff
+     * @brief 两份关卡配置的差异
+     */
+    struct Diff {
+        bool structural;                        ///< 卡牌数量变化，无法逐卡修补，需要重开关卡
+        std::vector<size_t> changedPlayfield;   ///< 内容变化的主牌堆卡牌下标
+        std::vector<size_t> changedStack;       ///< 内容变化的备用牌堆卡牌下标
+
+        Diff() : structural(false) {}
+        bool empty() const { return !structural && changedPlayfield.empty() && changedStack.empty(); }
+    };
+
+    using ReloadCallback = std::function<void(const LevelConfig& config, const Diff& diff)>;
+
+    static const float POLL_INTERVAL;
+
+    LevelHotReloader();
+    ~LevelHotReloader();
+
+    /**
+     * @brief 开始监视关卡文件
+     * @param levelId 关卡ID
+     * @param callback 文件变化且内容有差异时的回调（主线程）
+     */
+    void watch(int levelId, const ReloadCallback& callback);
+
+    /**
+     * @brief 停止监视
+     */
+    void stop();
+
+    /**
+     * @brief 逐卡对比两份关卡配置
+     */
+    static Diff diff(const LevelConfig& oldConfig, const LevelConfig& newConfig);
+
+private:
+    void poll(float dt);
+    static bool getModifiedTime(const std::string& fullPath, time_t& modifiedTime);
+
+    int _levelId;
+    std::string _fullPath;
+    time_t _modifiedTime;
+    LevelConfig _config;
+    ReloadCallback _callback;
+    bool _scheduled;
+};
+
+#endif // __LEVEL_HOT_RELOADER_H__
\ No newline at end of file
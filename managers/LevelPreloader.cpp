@@ -0,0 +1,163 @@
+#include "LevelPreloader.h"
+#include "../models/CardModel.h"
+#include "../services/GameModelFromLevelGenerator.h"
+#include "../configs/loaders/LevelConfigLoader.h"
+#include "../configs/loaders/LevelConfigCache.h"
+#include "../views/CardView.h"
+#include "../utils/CardAtlas.h"
+#include <algorithm>
+#include <chrono>
+
+USING_NS_CC;
+
+LevelPreloader::LevelPreloader()
+    : _levelId(0) {
+}
+
+LevelPreloader::~LevelPreloader() {
+    cancel();
+}
+
+void LevelPreloader::preload(int levelId) {
+    if (_levelId == levelId && (_pending.valid() || _result)) {
+        return;
+    }
+
+    cancel();
+    _levelId = levelId;
+
+    // 卡牌尺寸需要访问纹理缓存，文件读取需要FileUtils，都只能在主线程进行
+    Source source = readLevel(levelId, CardView::getCardSize());
+    _pending = std::async(std::launch::async, &LevelPreloader::buildLevel, levelId, std::move(source));
+    CCLOG("LevelPreloader: preloading level %d", levelId);
+}
+
+bool LevelPreloader::isLoading(int levelId) const {
+    return _levelId == levelId && _pending.valid() &&
+           _pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+bool LevelPreloader::hasLevel(int levelId) {
+    Result* result = pollResult(levelId);
+    return result && result->valid;
+}
+
+bool LevelPreloader::takePreloaded(int levelId, GameModel& gameModel, bool& dependencyGraphReady,
+                                   bool& loadedFromJson) {
+    Result* result = pollResult(levelId);
+    if (!result || !result->valid) {
+        return false;
+    }
+
+    gameModel = std::move(result->gameModel);
+    dependencyGraphReady = result->dependencyGraphReady;
+    loadedFromJson = result->loadedFromJson;
+    _result.reset();
+    _levelId = 0;
+    CCLOG("LevelPreloader: using preloaded level %d", levelId);
+    return true;
+}
+
+void LevelPreloader::cancel() {
+    // std::async的future析构时会等待后台任务结束，这里显式等待以保证顺序
+    if (_pending.valid()) {
+        _pending.wait();
+        _pending = std::future<Result>();
+    }
+    _result.reset();
+    _levelId = 0;
+}
+
+LevelPreloader::Result* LevelPreloader::pollResult(int levelId) {
+    if (_levelId != levelId) {
+        return nullptr;
+    }
+
+    if (_pending.valid()) {
+        if (_pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return nullptr;
+        }
+        _result.reset(new Result(_pending.get()));
+    }
+    return _result.get();
+}
+
+LevelPreloader::Source LevelPreloader::readLevel(int levelId, const Size& cardSize) {
+    Source source;
+    source.cardSize = cardSize;
+    
+    // 预编译关卡只做映射，覆盖关系按编译时的卡牌尺寸计算，尺寸不一致时退回JSON
+    if (LevelConfigLoader::loadCompiledLevel(levelId, source.compiledLevel)) {
+        if (source.compiledLevel.getCardSize().equals(cardSize)) {
+            source.compiled = true;
+            return source;
+        }
+        source.compiledLevel = CompiledLevel();
+    }
+    
+    if (LevelConfigCache::get(levelId, source.config)) {
+        source.configCached = true;
+        return source;
+    }
+    
+    std::string configPath = LevelConfigLoader::getConfigPath(levelId);
+    if (FileUtils::getInstance()->isFileExist(configPath)) {
+        source.json = FileUtils::getInstance()->getDataFromFile(configPath);
+    }
+    return source;
+}
+
+LevelPreloader::Result LevelPreloader::buildLevel(int levelId, Source source) {
+    Result result;
+    if (source.compiled) {
+        result.dependencyGraphReady = true;
+        result.gameModel = GameModelFromLevelGenerator::generateGameModel(source.compiledLevel);
+    } else if (source.configCached || !source.json.isNull()) {
+        if (!source.configCached) {
+            if (!source.config.fromJson(reinterpret_cast<const char*>(source.json.getBytes()),
+                                        (size_t)source.json.getSize())) {
+                CCLOGERROR("LevelPreloader: failed to parse level %d", levelId);
+                return result;
+            }
+            source.config.levelId = levelId;
+            
+            // 配置缓存自带锁，可以在后台线程写入
+            if (!source.config.playfieldCards.empty() || !source.config.stackCards.empty()) {
+                LevelConfigCache::put(levelId, source.config);
+            }
+        }
+        result.gameModel = GameModelFromLevelGenerator::generateGameModel(source.config);
+        
+        // 覆盖关系只取决于卡牌坐标和尺寸，与按视图包围盒构建的结果相同
+        result.gameModel.buildDependencyGraphFromPositions(source.cardSize);
+        result.dependencyGraphReady = true;
+        result.loadedFromJson = true;
+    } else {
+        CCLOG("LevelPreloader: level %d does not exist", levelId);
+        return result;
+    }
+
+    std::vector<std::string> texturePaths;
+    for (const auto& pair : result.gameModel.getAllCards()) {
+        CardView::collectTexturePaths(pair.second.getFace(), pair.second.getSuit(), texturePaths);
+    }
+    result.valid = !texturePaths.empty();
+
+    std::sort(texturePaths.begin(), texturePaths.end());
+    texturePaths.erase(std::unique(texturePaths.begin(), texturePaths.end()), texturePaths.end());
+
+    // 纹理缓存只能在主线程访问，addImageAsync会在cocos的加载线程解码图片
+    Director::getInstance()->getScheduler()->performFunctionInCocosThread([texturePaths]() {
+        // 卡牌图集常驻内存时无需再解码单独的图片；牌面按需合成，仍要用到这些图片
+        if (CardAtlas::isLoaded()) {
+            return;
+        }
+        
+        TextureCache* textureCache = Director::getInstance()->getTextureCache();
+        for (const auto& path : texturePaths) {
+            textureCache->addImageAsync(path, [](Texture2D*) {});
+        }
+    });
+
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef __LEVEL_PRELOADER_H__
+#define __LEVEL_PRELOADER_H__
+
+#include "cocos2d.h"
+#include "../models/GameModel.h"
+#include "../configs/models/LevelConfig.h"
+#include "../configs/models/CompiledLevel.h"
+#include <future>
+#include <memory>
+
+/**
+ * @class LevelPreloader
+ * @brief 关卡预加载器，在当前关卡进行时后台准备下一关
+ * 
+ * 职责：
+ * - 在主线程读取关卡文件（FileUtils只能在主线程使用），在后台线程解析配置并生成游戏模型
+ * - JSON关卡的覆盖关系也在后台按模型坐标构建，切换关卡时主线程不再做O(n²)的视图相交检测
+ * - 模型就绪后在主线程请求异步解码该关卡用到的纹理
+ * - 切换关卡时直接交出准备好的模型，避免主线程解析造成卡顿
+ * 
+ * 查询接口都不等待后台任务，尚未完成时视为未就绪。
+ * 同一时间只预加载一个关卡，新的预加载请求会替换旧的。
+ */
+class LevelPreloader {
+public:
+    LevelPreloader();
+    ~LevelPreloader();
+
+    /**
+     * @brief 开始在后台预加载关卡（必须在主线程调用）
+     * @param levelId 关卡ID
+     */
+    void preload(int levelId);
+
+    /**
+     * @brief 该关卡是否仍在后台准备中
+     */
+    bool isLoading(int levelId) const;
+
+    /**
+     * @brief 预加载的关卡是否已就绪（不等待后台任务）
+     * @param levelId 关卡ID
+     * @return 该关卡已预加载完成且包含卡牌
+     */
+    bool hasLevel(int levelId);
+
+    /**
+     * @brief 取出预加载好的模型，取出后预加载器清空（不等待后台任务）
+     * @param levelId 关卡ID
+     * @param gameModel 输出：预生成的游戏模型
+     * @param dependencyGraphReady 输出：依赖图是否已填充
+     * @param loadedFromJson 输出：关卡是否来自JSON源文件（而不是预编译关卡）
+     * @return 是否取到（未预加载该关卡、仍在准备或关卡无效时返回false）
+     */
+    bool takePreloaded(int levelId, GameModel& gameModel, bool& dependencyGraphReady, bool& loadedFromJson);
+
+    /**
+     * @brief 丢弃当前预加载结果
+     */
+    void cancel();
+
+private:
+    struct Result {
+        GameModel gameModel;
+        bool dependencyGraphReady;
+        bool loadedFromJson;
+        bool valid;
+
+        Result() : dependencyGraphReady(false), loadedFromJson(false), valid(false) {}
+    };
+
+    // 主线程读好的关卡数据，后台线程只做解析和模型生成
+    struct Source {
+        CompiledLevel compiledLevel;   ///< 与当前卡牌尺寸一致的预编译关卡（已映射）
+        bool compiled;
+        LevelConfig config;            ///< 命中配置缓存时的配置
+        bool configCached;
+        cocos2d::Data json;            ///< 其余情况下关卡JSON的原始字节，文件不存在时为空
+        cocos2d::Size cardSize;        ///< 构建JSON关卡覆盖关系用的卡牌尺寸
+
+        Source() : compiled(false), configCached(false) {}
+    };
+
+    // 主线程执行：映射预编译关卡或读取JSON文件
+    static Source readLevel(int levelId, const cocos2d::Size& cardSize);
+    // 后台线程执行：生成模型和覆盖关系，并通知主线程预加载纹理
+    static Result buildLevel(int levelId, Source source);
+    // 后台任务已完成时取出结果，否则返回nullptr
+    Result* pollResult(int levelId);
+
+    int _levelId;
+    std::future<Result> _pending;
+    std::unique_ptr<Result> _result;
+};
+
+#endif // __LEVEL_PRELOADER_H__
\ No newline at end of file
@@ -0,0 +1,271 @@
+#include "MoveJournal.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+const char MoveJournal::MAGIC[4] = { 'C', 'E', 'J', 'L' };
+const int32_t MoveJournal::VERSION;
+const size_t MoveJournal::BATCH_SIZE;
+const int MoveJournal::FLUSH_INTERVAL_MS;
+
+MoveJournal::MoveJournal(const std::string& path)
+    : _path(path)
+    , _sessionId(0)
+    , _entryCount(0)
+    , _file(nullptr)
+    , _resetPending(false)
+    , _resetLevelId(0)
+    , _resetSessionId(0)
+    , _clearPending(false)
+    , _flushRequested(false)
+    , _stopping(false) {
+    _pending.reserve(BATCH_SIZE * 4);
+    _writing.reserve(BATCH_SIZE * 4);
+    _writer = std::thread(&MoveJournal::writerLoop, this);
+    CCLOG("MoveJournal created: %s", _path.c_str());
+}
+
+MoveJournal::~MoveJournal() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_one();
+    if (_writer.joinable()) {
+        _writer.join();
+    }
+
+    if (_file) {
+        fclose(_file);
+        _file = nullptr;
+    }
+    CCLOG("MoveJournal destroyed");
+}
+
+void MoveJournal::begin(int levelId) {
+    // 以时间戳生成新会话ID，与上一局保证不同
+    uint32_t sessionId = (uint32_t)std::chrono::system_clock::now().time_since_epoch().count();
+    if (sessionId == _sessionId) {
+        sessionId++;
+    }
+    startSession(levelId, sessionId, std::vector<Entry>());
+}
+
+void MoveJournal::resume(int levelId, uint32_t sessionId, const std::vector<Entry>& entries) {
+    startSession(levelId, sessionId, entries);
+}
+
+void MoveJournal::startSession(int levelId, uint32_t sessionId, const std::vector<Entry>& entries) {
+    _sessionId = sessionId;
+    _entryCount = entries.size();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // 未写盘的旧记录属于上一局，直接丢弃
+        _pending.assign(entries.begin(), entries.end());
+        _resetPending = true;
+        _resetLevelId = levelId;
+        _resetSessionId = sessionId;
+    }
+    _condition.notify_one();
+}
+
+void MoveJournal::finish() {
+    _entryCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // 已结束的对局不再需要恢复，未写盘的记录一并丢弃
+        _pending.clear();
+        _resetPending = false;
+        _clearPending = true;
+    }
+    _condition.notify_one();
+}
+
+void MoveJournal::append(EntryType type, int cardId1, int cardId2) {
+    Entry entry;
+    entry.type = type;
+    entry.cardId1 = cardId1;
+    entry.cardId2 = cardId2;
+    _entryCount++;
+
+    bool batchFull = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.push_back(entry);
+        batchFull = _pending.size() >= BATCH_SIZE;
+    }
+
+    if (batchFull) {
+        _condition.notify_one();
+    }
+}
+
+void MoveJournal::flush() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _flushRequested = true;
+    }
+    _condition.notify_one();
+}
+
+void MoveJournal::writerLoop() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _condition.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS), [this]() {
+            return _stopping || _flushRequested || _resetPending || _clearPending || _pending.size() >= BATCH_SIZE;
+        });
+
+        if (_pending.empty() && !_resetPending && !_clearPending) {
+            _flushRequested = false;
+            if (_stopping) {
+                break;
+            }
+            continue;
+        }
+
+        // 取走当前批次后释放锁，文件IO期间主线程可继续追加
+        _writing.swap(_pending);
+        bool reset = _resetPending;
+        bool clear = _clearPending;
+        int levelId = _resetLevelId;
+        uint32_t sessionId = _resetSessionId;
+        _resetPending = false;
+        _clearPending = false;
+        _flushRequested = false;
+        lock.unlock();
+
+        // finish()之后紧接着begin()时，先删除旧日志再写新日志
+        if (clear) {
+            removeFile();
+        }
+        if (reset) {
+            rewriteFile(levelId, sessionId, _writing);
+        } else if (!_writing.empty()) {
+            appendToFile(_writing);
+        }
+        _writing.clear();
+
+        lock.lock();
+    }
+}
+
+void MoveJournal::rewriteFile(int levelId, uint32_t sessionId, const std::vector<Entry>& entries) {
+    if (_file) {
+        fclose(_file);
+        _file = nullptr;
+    }
+
+    // 先写临时文件再替换，崩溃时旧日志或新日志至少有一个完整
+    std::string tempPath = _path + ".tmp";
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (!file) {
+        CCLOGERROR("MoveJournal: failed to create %s", tempPath.c_str());
+        return;
+    }
+
+    Header header;
+    memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.levelId = levelId;
+    header.sessionId = sessionId;
+    fwrite(&header, sizeof(header), 1, file);
+    if (!entries.empty()) {
+        fwrite(entries.data(), sizeof(Entry), entries.size(), file);
+    }
+    _file = file;
+    syncFile();
+    fclose(_file);
+    _file = nullptr;
+
+    // 原子替换：替换过程中崩溃时旧日志仍完整
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
+    bool replaced = MoveFileExA(tempPath.c_str(), _path.c_str(),
+                                MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    bool replaced = rename(tempPath.c_str(), _path.c_str()) == 0;
+#endif
+    if (!replaced) {
+        CCLOGERROR("MoveJournal: failed to replace %s", _path.c_str());
+        return;
+    }
+
+    _file = fopen(_path.c_str(), "ab");
+    if (!_file) {
+        CCLOGERROR("MoveJournal: failed to reopen %s", _path.c_str());
+    }
+}
+
+void MoveJournal::removeFile() {
+    if (_file) {
+        fclose(_file);
+        _file = nullptr;
+    }
+    remove(_path.c_str());
+    CCLOG("MoveJournal: removed %s", _path.c_str());
+}
+
+void MoveJournal::appendToFile(const std::vector<Entry>& entries) {
+    if (!_file) {
+        CCLOGERROR("MoveJournal: journal not started, dropping %d entries", (int)entries.size());
+        return;
+    }
+
+    fwrite(entries.data(), sizeof(Entry), entries.size(), _file);
+    syncFile();
+}
+
+void MoveJournal::syncFile() {
+    fflush(_file);
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
+    _commit(_fileno(_file));
+#else
+    fsync(fileno(_file));
+#endif
+}
+
+bool MoveJournal::load(const std::string& path, Contents& contents) {
+    std::vector<Entry>& entries = contents.entries;
+    entries.clear();
+
+    if (!FileUtils::getInstance()->isFileExist(path)) {
+        return false;
+    }
+
+    Data data = FileUtils::getInstance()->getDataFromFile(path);
+    if (data.isNull() || (size_t)data.getSize() < sizeof(Header)) {
+        return false;
+    }
+
+    const unsigned char* bytes = data.getBytes();
+    Header header;
+    memcpy(&header, bytes, sizeof(header));
+    if (memcmp(header.magic, MAGIC, sizeof(header.magic)) != 0 || header.version != VERSION) {
+        CCLOGERROR("MoveJournal: unrecognized journal %s", path.c_str());
+        return false;
+    }
+
+    // 只保留完整的记录，崩溃时写了一半的尾部直接丢弃
+    size_t count = ((size_t)data.getSize() - sizeof(Header)) / sizeof(Entry);
+    entries.resize(count);
+    if (count > 0) {
+        memcpy(entries.data(), bytes + sizeof(Header), count * sizeof(Entry));
+    }
+
+    contents.levelId = header.levelId;
+    contents.sessionId = header.sessionId;
+    CCLOG("MoveJournal loaded: level %d, %d entries", contents.levelId, (int)count);
+    return true;
+}
+
+std::string MoveJournal::getDefaultPath() {
+    return FileUtils::getInstance()->getWritablePath() + "session.journal";
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#ifndef __MOVE_JOURNAL_H__
+#define __MOVE_JOURNAL_H__
+
+#include "cocos2d.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * @class MoveJournal
+ * @brief 只追加的操作日志，用于崩溃后恢复进行中的对局
+ * 
+ * 职责：
+ * - 记录每一步操作（匹配、抽牌、回退、重做）
+ * - 在后台线程批量写盘并fsync，主线程只做内存追加
+ * - 启动时读取日志，供GameController回放重建对局
+ * 
+ * 文件格式：固定16字节文件头 + 若干固定12字节记录。
+ * 崩溃造成的不完整尾部记录在读取时被丢弃。
+ */
+class MoveJournal {
+public:
+    /**
+     * @enum EntryType
+     * @brief 日志记录类型
+     */
+    enum class EntryType : int32_t {
+        CARD_MATCH = 1,     ///< 主牌堆卡牌与底牌匹配
+        STACK_DRAW = 2,     ///< 从备用牌堆抽牌
+        UNDO = 3,           ///< 回退一步
+        REDO = 4            ///< 重做一步
+    };
+
+    /**
+     * @struct Entry
+     * @brief 单条日志记录，按原样写入文件
+     */
+    struct Entry {
+        EntryType type;
+        int32_t cardId1;
+        int32_t cardId2;
+    };
+
+    /**
+     * @struct Contents
+     * @brief 从文件读出的完整日志
+     */
+    struct Contents {
+        int levelId;
+        uint32_t sessionId;             ///< 每局唯一，用于判断存档与日志是否属于同一局
+        std::vector<Entry> entries;
+
+        Contents() : levelId(0), sessionId(0) {}
+    };
+
+    explicit MoveJournal(const std::string& path);
+    ~MoveJournal();
+
+    /**
+     * @brief 开始新对局的日志（异步替换旧日志文件）
+     * @param levelId 关卡ID
+     */
+    void begin(int levelId);
+
+    /**
+     * @brief 接续已有对局的日志（用于从存档恢复，保留原会话ID）
+     * @param levelId 关卡ID
+     * @param sessionId 会话ID
+     * @param entries 需要保留的已有记录
+     */
+    void resume(int levelId, uint32_t sessionId, const std::vector<Entry>& entries);
+
+    /**
+     * @brief 结束当前对局的日志（异步删除日志文件，关卡完成后调用，避免下次启动时回放已结束的对局）
+     */
+    void finish();
+
+    /**
+     * @brief 追加一条记录（只写内存，不阻塞调用线程）
+     * @param type 记录类型
+     * @param cardId1 卡牌1 ID
+     * @param cardId2 卡牌2 ID
+     */
+    void append(EntryType type, int cardId1 = -1, int cardId2 = -1);
+
+    /**
+     * @brief 请求后台线程立即写盘（不等待写盘完成）
+     */
+    void flush();
+
+    /**
+     * @brief 获取当前对局的会话ID
+     * @return 会话ID
+     */
+    uint32_t getSessionId() const { return _sessionId; }
+
+    /**
+     * @brief 获取当前对局已追加的记录数
+     * @return 记录数
+     */
+    size_t getEntryCount() const { return _entryCount; }
+
+    /**
+     * @brief 读取日志文件
+     * @param path 日志路径
+     * @param contents 输出：日志内容（只包含完整的记录）
+     * @return 是否存在可用的日志
+     */
+    static bool load(const std::string& path, Contents& contents);
+
+    /**
+     * @brief 获取默认日志路径（可写目录下）
+     * @return 日志路径
+     */
+    static std::string getDefaultPath();
+
+private:
+    /**
+     * @struct Header
+     * @brief 日志文件头
+     */
+    struct Header {
+        char magic[4];
+        int32_t version;
+        int32_t levelId;
+        uint32_t sessionId;
+    };
+
+    void writerLoop();
+    void startSession(int levelId, uint32_t sessionId, const std::vector<Entry>& entries);
+    void rewriteFile(int levelId, uint32_t sessionId, const std::vector<Entry>& entries);
+    void appendToFile(const std::vector<Entry>& entries);
+    void removeFile();
+    void syncFile();
+
+    static const char MAGIC[4];
+    static const int32_t VERSION = 1;
+    static const size_t BATCH_SIZE = 32;            ///< 攒够多少条立即写盘
+    static const int FLUSH_INTERVAL_MS = 200;       ///< 最长写盘间隔
+
+    std::string _path;
+    uint32_t _sessionId;                ///< 仅由主线程修改
+    size_t _entryCount;                 ///< 仅由主线程修改
+    FILE* _file;                        ///< 仅由写盘线程访问
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::vector<Entry> _pending;        ///< 主线程追加，写盘线程取走
+    std::vector<Entry> _writing;        ///< 写盘线程的批次缓冲，与_pending交换复用
+    bool _resetPending;
+    int _resetLevelId;
+    uint32_t _resetSessionId;
+    bool _clearPending;
+    bool _flushRequested;
+    bool _stopping;
+    std::thread _writer;
+};
+
+#endif // __MOVE_JOURNAL_H__
\ No newline at end of file
@@ -105,16 +105,21 @@ bool UndoManager::undo() {
         return false;
     }
 
-    UndoStep step = _undoModel.popStep();
+    // 只移动游标，步骤仍保留在存储中供重做使用
+    const UndoStep* step = _undoModel.undoStep();
     CCLOG("Undoing step");
 
     bool success = false;
-    switch (step.actionType) {
+    switch (step->actionType) {
     case UndoActionType::CARD_MATCH:
-        success = restoreCardMatch(step);
+        success = restoreCardMatch(*step);
+        // 匹配计入步数，回退时扣回，与重做对称
+        if (success) {
+            _gameModel->decrementMoveCount();
+        }
         break;
     case UndoActionType::STACK_DRAW:
-        success = restoreStackDraw(step);
+        success = restoreStackDraw(*step);
         break;
     }
 
@@ -125,6 +130,44 @@ bool UndoManager::canUndo() const {
     return _undoModel.canUndo();
 }
 
+bool UndoManager::redo() {
+    if (!canRedo()) {
+        CCLOG("No steps to redo");
+        return false;
+    }
+
+    if (!_gameModel) {
+        CCLOGERROR("UndoManager not initialized");
+        return false;
+    }
+
+    const UndoStep* step = _undoModel.redoStep();
+    CCLOG("Redoing step");
+
+    bool success = false;
+    switch (step->actionType) {
+    case UndoActionType::CARD_MATCH:
+        success = reapplyCardMatch(*step);
+        if (success) {
+            _gameModel->incrementMoveCount();
+        }
+        break;
+    case UndoActionType::STACK_DRAW:
+        success = reapplyStackDraw(*step);
+        break;
+    }
+
+    return success;
+}
+
+bool UndoManager::canRedo() const {
+    return _undoModel.canRedo();
+}
+
+const UndoStep* UndoManager::peekRedoStep() const {
+    return _undoModel.peekRedoStep();
+}
+
 void UndoManager::clear() {
     _undoModel.clear();
     CCLOG("UndoManager cleared");
@@ -134,6 +177,10 @@ size_t UndoManager::getStepCount() const {
     return _undoModel.getStepCount();
 }
 
+size_t UndoManager::getRedoCount() const {
+    return _undoModel.getRedoCount();
+}
+
 void UndoManager::setMaxSteps(size_t maxSteps) {
     _undoModel.setMaxSteps(maxSteps);
 }
@@ -221,6 +268,42 @@ bool UndoManager::restoreStackDraw(const UndoStep& step) {
     return (stackCard != nullptr && bottomCard != nullptr);
 }
 
+bool UndoManager::reapplyCardMatch(const UndoStep& step) {
+    CCLOG("Reapplying card match: %d -> %d", step.cardId1, step.cardId2);
+
+    // 与CardController::handlePlayfieldCardClick的匹配流程保持一致
+    CardModel* playfieldCard = _gameModel->getCard(step.cardId1);
+    if (!playfieldCard) {
+        return false;
+    }
+
+    _gameModel->removeCardFromPlayfield(step.cardId1);
+    _gameModel->pushToBottomPile(step.cardId1);
+    _gameModel->setTopCard(step.cardId1);
+    return true;
+}
+
+bool UndoManager::reapplyStackDraw(const UndoStep& step) {
+    CCLOG("Reapplying stack draw: %d -> %d", step.cardId1, step.cardId2);
+
+    // 与CardController::handleStackCardClick的抽牌流程保持一致
+    CardModel* stackCard = _gameModel->getCard(step.cardId1);
+    if (!stackCard) {
+        return false;
+    }
+
+    if (_gameModel->getStackPileTop() != step.cardId1) {
+        CCLOGERROR("Stack pile top (%d) doesn't match expected card (%d)", _gameModel->getStackPileTop(), step.cardId1);
+    }
+
+    stackCard->setIsInPlayfield(false);
+    stackCard->setCovered(false);
+    _gameModel->removeFromStack(step.cardId1);
+    _gameModel->pushToBottomPile(step.cardId1);
+    _gameModel->setTopCard(step.cardId1);
+    return true;
+}
+
 Vec2 UndoManager::findCardOriginalPosition(int cardId) const {
     if (!_gameModel) {
         return Vec2::ZERO;
@@ -31,15 +31,31 @@ public:
     // ǷԻ
     bool canUndo() const;
 
+    // ִӦһα˵Ĳ裩
+    bool redo();
+
+    // Ƿ
+    bool canRedo() const;
+
+    // 鿴һ裨ʱnullptr
+    const UndoStep* peekRedoStep() const;
+
     // л˼¼
     void clear();
 
     // ȡ˲
     size_t getStepCount() const;
 
+    // ȡ
+    size_t getRedoCount() const;
+
     // ˲
     void setMaxSteps(size_t maxSteps);
 
+    // ȡģͣڴ浵д
+    UndoModel& getUndoModel() { return _undoModel; }
+    const UndoModel& getUndoModel() const { return _undoModel; }
+
 private:
     // ָƥ
     bool restoreCardMatch(const UndoStep& step);
@@ -47,6 +63,12 @@ private:
     // ָƲ
     bool restoreStackDraw(const UndoStep& step);
 
+    // Ӧÿƥ
+    bool reapplyCardMatch(const UndoStep& step);
+
+    // ӦóƲ
+    bool reapplyStackDraw(const UndoStep& step);
+
     // ҿƵԭʼλ
     cocos2d::Vec2 findCardOriginalPosition(int cardId) const;
 
@@ -1,4 +1,5 @@
 #include "CardModel.h"
+#include "../utils/CardTables.h"
 #include <cmath>
 
 USING_NS_CC;
@@ -24,7 +25,7 @@ CardModel::CardModel(int cardId, CardFaceType face, CardSuitType suit, const Vec
 }
 
 int CardModel::getFaceValue() const {
-    return static_cast<int>(_face);
+    return CardTables::faceValueOf(_face);
 }
 
 bool CardModel::canMatchWith(const CardModel& other) const {
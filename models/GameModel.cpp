@@ -1,6 +1,8 @@
 #include "GameModel.h"
 #include "../views/CardView.h"
+#include "../utils/GameUtils.h"
 #include <algorithm>
+#include <unordered_set>
 #include <iterator>
 
 USING_NS_CC;
@@ -9,7 +11,9 @@ GameModel::GameModel()
     : _currentTopCardId(-1)
     , _gameState(GameState::INITIALIZING)
     , _score(0)
-    , _moveCount(0) {
+    , _moveCount(0)
+    , _changeEventsEnabled(true)
+    , _zOrderTableDirty(true) {
 }
 
 CardModel* GameModel::getCard(int cardId) {
@@ -41,6 +45,7 @@ void GameModel::addCard(const CardModel& card, bool isPlayfield) {
     CCLOG("GameModel::addCard - adding card ID=%d, isPlayfield=%s", cardId, isPlayfield ? "true" : "false");
     
     _allCards[cardId] = card;
+    _zOrderTableDirty = true;
     CCLOG("GameModel::addCard - card added to _allCards, total cards: %d", (int)_allCards.size());
 
     if (isPlayfield) {
@@ -72,7 +77,14 @@ void GameModel::setTopCard(int cardId) {
         return;
     }
 
+    int previousTopCardId = _currentTopCardId;
     _currentTopCardId = cardId;
+    if (previousTopCardId != cardId) {
+        if (previousTopCardId != -1) {
+            emitChange(ChangeEvent::Type::CARD_MOVED, previousTopCardId);
+        }
+        emitChange(ChangeEvent::Type::TOP_CARD_CHANGED, cardId);
+    }
 
     // ȷ���������ڶ�ջ��ǰ��
     auto it = std::find(_stackCardIds.begin(), _stackCardIds.end(), cardId);
@@ -124,9 +136,12 @@ void GameModel::removeFromPlayfield(int cardId) {
     // 然后从容器中移除
     auto it = std::find(_playfieldCardIds.begin(), _playfieldCardIds.end(), cardId);
     if (it != _playfieldCardIds.end()) {
+        size_t index = it - _playfieldCardIds.begin();
         _playfieldCardIds.erase(it);
+        onPlayfieldIdErased(cardId, index);
         CCLOG("Removed card %d from playfield", cardId);
     }
+    emitChange(ChangeEvent::Type::CARD_MOVED, cardId);
 }
 
 void GameModel::removeFromStack(int cardId) {
@@ -147,16 +162,19 @@ void GameModel::removeFromStack(int cardId) {
     if (pileIt != _stackPile.end()) {
         _stackPile.erase(pileIt);
     }
+    emitChange(ChangeEvent::Type::CARD_MOVED, cardId);
 }
 
 // 栈结构管理
 void GameModel::pushToStackPile(int cardId) {
     _stackPile.push_back(cardId);
+    emitChange(ChangeEvent::Type::CARD_MOVED, cardId);
 }
 
 void GameModel::pushToStackPileAndContainer(int cardId) {
     _stackPile.push_back(cardId);
     _stackCardIds.push_back(cardId);
+    emitChange(ChangeEvent::Type::CARD_MOVED, cardId);
 }
 
 int GameModel::popFromStackPile() {
@@ -188,6 +206,7 @@ int GameModel::popFromStackPile() {
     }
     CCLOG("]");
     
+    emitChange(ChangeEvent::Type::CARD_MOVED, cardId);
     CCLOG("Popped card %d from stack pile", cardId);
     return cardId;
 }
@@ -209,6 +228,8 @@ void GameModel::pushToBottomPile(int cardId) {
     
     _bottomPile.push_back(cardId);
     _bottomCardIds.push_back(cardId);
+    onBottomIdAppended(cardId);
+    emitChange(ChangeEvent::Type::CARD_MOVED, cardId);
     
     CCLOG("After pushToBottomPile - _stackCardIds: [");
     for (int id : _stackCardIds) {
@@ -232,10 +253,13 @@ int GameModel::popFromBottomPile() {
     // 同时从 _bottomCardIds 中移除
     auto it = std::find(_bottomCardIds.begin(), _bottomCardIds.end(), cardId);
     if (it != _bottomCardIds.end()) {
+        size_t index = it - _bottomCardIds.begin();
         _bottomCardIds.erase(it);
+        onBottomIdErased(cardId, index);
         CCLOG("Removed card %d from bottom card IDs", cardId);
     }
     
+    emitChange(ChangeEvent::Type::CARD_MOVED, cardId);
     CCLOG("Popped card %d from bottom pile", cardId);
     CCLOG("Bottom pile now has %d cards", (int)_bottomPile.size());
     return cardId;
@@ -265,18 +289,7 @@ bool GameModel::isBottomPileEmpty() const {
 
 // 依赖图管理
 void GameModel::buildDependencyGraph() {
-    _dependencyGraph.clear();
-    _playfieldStatus.clear();
-    
-    // 初始化所有主牌堆卡牌状态
-    for (int cardId : _playfieldCardIds) {
-        _playfieldStatus[cardId] = true;
-    }
-    
-    // 初始化所有备用牌堆卡牌状态（虽然它们不会覆盖主牌堆卡牌，但需要避免访问异常）
-    for (int cardId : _stackCardIds) {
-        _playfieldStatus[cardId] = false;  // 备用牌堆卡牌不在主牌堆中
-    }
+    clearDependencyGraph();
     
     // 使用简化的JSON顺序逻辑构建依赖图
     // 按JSON顺序，后面的卡牌覆盖前面的卡牌
@@ -318,18 +331,7 @@ void GameModel::buildDependencyGraphWithViews(const std::unordered_map<int, Card
     CCLOG("=== Building Dependency Graph with Real Collision Detection ===");
     
     // 清空之前的依赖图
-    _dependencyGraph.clear();
-    _playfieldStatus.clear();
-    
-    // 初始化所有主牌堆卡牌状态
-    for (int cardId : _playfieldCardIds) {
-        _playfieldStatus[cardId] = true;
-    }
-    
-    // 初始化所有备用牌堆卡牌状态（虽然它们不会覆盖主牌堆卡牌，但需要避免访问异常）
-    for (int cardId : _stackCardIds) {
-        _playfieldStatus[cardId] = false;  // 备用牌堆卡牌不在主牌堆中
-    }
+    clearDependencyGraph();
     
     CCLOG("Playfield cards: [");
     for (int cardId : _playfieldCardIds) {
@@ -378,6 +380,93 @@ void GameModel::buildDependencyGraphWithViews(const std::unordered_map<int, Card
     CCLOG("=== Real Collision-based Dependency Graph Complete ===");
 }
 
+void GameModel::buildDependencyGraphFromPositions(const Size& cardSize) {
+    clearDependencyGraph();
+    
+    // 以模型坐标计算包围盒（视图只有统一的偏移，不影响相交判断）
+    std::vector<Rect> boundingBoxes;
+    boundingBoxes.reserve(_playfieldCardIds.size());
+    for (int cardId : _playfieldCardIds) {
+        const CardModel* card = getCard(cardId);
+        Vec2 pos = card ? card->getPosition() : Vec2::ZERO;
+        boundingBoxes.push_back(Rect(pos.x - cardSize.width * 0.5f, pos.y - cardSize.height * 0.5f,
+                                     cardSize.width, cardSize.height));
+    }
+    
+    // 后摆放的卡牌覆盖先摆放且相交的卡牌
+    for (size_t i = 0; i < _playfieldCardIds.size(); ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            if (boundingBoxes[i].intersectsRect(boundingBoxes[j])) {
+                addDependency(_playfieldCardIds[i], _playfieldCardIds[j]);
+            }
+        }
+    }
+    
+    CCLOG("Dependency graph built from positions for %d playfield cards", (int)_playfieldCardIds.size());
+}
+
+void GameModel::clearDependencyGraph() {
+    _dependencyGraph.clear();
+    _playfieldStatus.clear();
+    
+    // 初始化所有主牌堆卡牌状态
+    for (int cardId : _playfieldCardIds) {
+        _playfieldStatus[cardId] = true;
+    }
+    
+    // 初始化所有备用牌堆卡牌状态（虽然它们不会覆盖主牌堆卡牌，但需要避免访问异常）
+    for (int cardId : _stackCardIds) {
+        _playfieldStatus[cardId] = false;  // 备用牌堆卡牌不在主牌堆中
+    }
+}
+
+void GameModel::updateDependencies(const std::vector<int>& changedCardIds, const std::vector<int>& placementOrder,
+                                   const Size& cardSize) {
+    std::unordered_set<int> changed(changedCardIds.begin(), changedCardIds.end());
+    
+    // 移除所有与变化卡牌相关的覆盖关系
+    for (auto& pair : _dependencyGraph) {
+        if (changed.count(pair.first)) {
+            pair.second.clear();
+            continue;
+        }
+        std::vector<int>& coveredCards = pair.second;
+        coveredCards.erase(std::remove_if(coveredCards.begin(), coveredCards.end(),
+                                          [&changed](int id) { return changed.count(id) != 0; }),
+                           coveredCards.end());
+    }
+    
+    // 以模型坐标计算包围盒（视图只有统一的偏移，不影响相交判断）
+    auto boundingBoxOf = [this, &cardSize](int cardId) {
+        const CardModel* card = getCard(cardId);
+        Vec2 pos = card ? card->getPosition() : Vec2::ZERO;
+        return Rect(pos.x - cardSize.width * 0.5f, pos.y - cardSize.height * 0.5f, cardSize.width, cardSize.height);
+    };
+    
+    // 只检查涉及变化卡牌的卡牌对：后摆放的覆盖先摆放的
+    for (size_t i = 0; i < placementOrder.size(); ++i) {
+        int cardId = placementOrder[i];
+        if (!changed.count(cardId)) continue;
+        
+        Rect rect = boundingBoxOf(cardId);
+        for (size_t j = 0; j < placementOrder.size(); ++j) {
+            if (j == i) continue;
+            int otherId = placementOrder[j];
+            // 两张都变化的卡牌对只由后摆放的一方处理一次
+            if (j > i && changed.count(otherId)) continue;
+            if (!rect.intersectsRect(boundingBoxOf(otherId))) continue;
+            
+            if (j < i) {
+                addDependency(cardId, otherId);
+            } else {
+                addDependency(otherId, cardId);
+            }
+        }
+    }
+    
+    CCLOG("Dependency graph updated for %d changed cards", (int)changedCardIds.size());
+}
+
 void GameModel::addDependency(int cardId, int coveredCardId) {
     _dependencyGraph[cardId].push_back(coveredCardId);
 }
@@ -417,8 +506,13 @@ void GameModel::removeCardFromPlayfield(int cardId) {
     // 从主牌堆容器中移除
     auto it = std::find(_playfieldCardIds.begin(), _playfieldCardIds.end(), cardId);
     if (it != _playfieldCardIds.end()) {
+        size_t index = it - _playfieldCardIds.begin();
         _playfieldCardIds.erase(it);
+        onPlayfieldIdErased(cardId, index);
     }
+    
+    emitChange(ChangeEvent::Type::CARD_MOVED, cardId);
+    emitCoverChanges(cardId);
 }
 
 void GameModel::restoreCardToPlayfield(int cardId) {
@@ -427,4 +521,134 @@ void GameModel::restoreCardToPlayfield(int cardId) {
     
     // 重新添加到主牌堆容器
     _playfieldCardIds.push_back(cardId);
+    onPlayfieldIdAppended(cardId);
+    
+    emitChange(ChangeEvent::Type::CARD_MOVED, cardId);
+    emitCoverChanges(cardId);
+}
+
+void GameModel::drainChangeEvents(std::vector<ChangeEvent>& out) {
+    // 交换而不是拷贝：两个缓冲区轮流使用，稳定后每帧不再分配内存
+    out.clear();
+    out.swap(_changeEvents);
+}
+
+void GameModel::setChangeEventsEnabled(bool enabled) {
+    _changeEventsEnabled = enabled;
+    if (!enabled) {
+        _changeEvents.clear();
+    }
+}
+
+void GameModel::emitChange(ChangeEvent::Type type, int cardId) {
+    if (!_changeEventsEnabled) {
+        return;
+    }
+    _changeEvents.push_back({type, cardId});
+}
+
+const GameModel::ZOrderSlot* GameModel::findZOrderSlot(int cardId) const {
+    if (_zOrderTableDirty) {
+        rebuildZOrderSlots();
+    }
+    
+    auto it = _zOrderSlots.find(cardId);
+    return it != _zOrderSlots.end() ? &it->second : nullptr;
+}
+
+void GameModel::rebuildZOrderSlots() const {
+    // 整表重建只在载入关卡或存档后发生一次；每张卡牌都预留槽位，
+    // 之后卡牌进出牌堆只改写已有槽位，不再分配内存
+    _zOrderSlots.clear();
+    _zOrderSlots.reserve(_allCards.size());
+    for (const auto& pair : _allCards) {
+        _zOrderSlots[pair.first] = ZOrderSlot();
+    }
+    for (size_t i = 0; i < _playfieldCardIds.size(); ++i) {
+        _zOrderSlots[_playfieldCardIds[i]].playfieldIndex = (int)i;
+    }
+    for (size_t i = 0; i < _bottomCardIds.size(); ++i) {
+        _zOrderSlots[_bottomCardIds[i]].bottomIndex = (int)i;
+    }
+    _zOrderTableDirty = false;
+}
+
+void GameModel::onPlayfieldIdAppended(int cardId) {
+    if (!_zOrderTableDirty) {
+        _zOrderSlots[cardId].playfieldIndex = (int)_playfieldCardIds.size() - 1;
+    }
+}
+
+void GameModel::onPlayfieldIdErased(int cardId, size_t index) {
+    if (_zOrderTableDirty) {
+        return;
+    }
+    _zOrderSlots[cardId].playfieldIndex = -1;
+    
+    // 移除点之后的卡牌前移一位，与容器的erase同为O(n - index)
+    for (size_t i = index; i < _playfieldCardIds.size(); ++i) {
+        _zOrderSlots[_playfieldCardIds[i]].playfieldIndex = (int)i;
+    }
+}
+
+void GameModel::onBottomIdAppended(int cardId) {
+    if (!_zOrderTableDirty) {
+        _zOrderSlots[cardId].bottomIndex = (int)_bottomCardIds.size() - 1;
+    }
+}
+
+void GameModel::onBottomIdErased(int cardId, size_t index) {
+    if (_zOrderTableDirty) {
+        return;
+    }
+    _zOrderSlots[cardId].bottomIndex = -1;
+    
+    // 底牌堆通常从末尾弹出，循环不执行
+    for (size_t i = index; i < _bottomCardIds.size(); ++i) {
+        _zOrderSlots[_bottomCardIds[i]].bottomIndex = (int)i;
+    }
+}
+
+int GameModel::getCardZOrder(int cardId) const {
+    const CardModel* cardModel = getCard(cardId);
+    if (!cardModel) {
+        CCLOGERROR("CardModel not found for card %d", cardId);
+        return GameUtils::STACK_ZORDER_BASE;
+    }
+    
+    const ZOrderSlot* slot = findZOrderSlot(cardId);
+    
+    // 优先按底牌堆处理（底牌堆卡牌的 isInPlayfield 也是 false），越靠后层级越高
+    if (slot && slot->bottomIndex >= 0) {
+        return GameUtils::BOTTOM_PILE_ZORDER_BASE + slot->bottomIndex;
+    }
+    
+    if (cardModel->isInPlayfield()) {
+        // 主牌堆卡牌：JSON顺序越靠后，zOrder越高
+        int playfieldIndex = (slot && slot->playfieldIndex >= 0) ? slot->playfieldIndex : 0;
+        return GameUtils::PLAYFIELD_ZORDER_BASE + playfieldIndex;
+    }
+    
+    // 备用牌堆卡牌：正常层级
+    return GameUtils::STACK_ZORDER_BASE;
+}
+
+int GameModel::getPlayfieldOrder(int cardId) const {
+    const ZOrderSlot* slot = findZOrderSlot(cardId);
+    return slot ? slot->playfieldIndex : -1;
+}
+
+int GameModel::getBottomPileOrder(int cardId) const {
+    const ZOrderSlot* slot = findZOrderSlot(cardId);
+    return slot ? slot->bottomIndex : -1;
+}
+
+void GameModel::emitCoverChanges(int coveringCardId) {
+    auto it = _dependencyGraph.find(coveringCardId);
+    if (it == _dependencyGraph.end()) {
+        return;
+    }
+    for (int coveredCardId : it->second) {
+        emitChange(ChangeEvent::Type::COVER_CHANGED, coveredCardId);
+    }
 }
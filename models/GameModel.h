@@ -12,6 +12,9 @@
 class CardView;
 
 class GameModel {
+    // 存档服务需要直接读写全部状态
+    friend class GameSnapshotService;
+
 public:
     enum class GameState {
         INITIALIZING,
@@ -50,6 +53,7 @@ public:
     void setScore(int score) { _score = score; }
     int getMoveCount() const { return _moveCount; }
     void incrementMoveCount() { _moveCount++; }
+    void decrementMoveCount() { if (_moveCount > 0) _moveCount--; }
 
     // ��Ϸ�߼�
     bool checkGameWin() const;
@@ -70,12 +74,55 @@ public:
     // 依赖图管理
     void buildDependencyGraph();
     void buildDependencyGraphWithViews(const std::unordered_map<int, CardView*>& cardViews);
+    // 按模型坐标和卡牌尺寸构建依赖图，结果与按视图包围盒构建相同，不需要视图（可在后台线程对未挂接的模型调用）
+    void buildDependencyGraphFromPositions(const cocos2d::Size& cardSize);
+    void clearDependencyGraph();  // 清空依赖图并初始化主牌堆状态，之后可用addDependency逐条填充
+    // 局部重建：只重新计算与changedCardIds相关的覆盖关系（placementOrder为主牌堆卡牌的摆放顺序）
+    void updateDependencies(const std::vector<int>& changedCardIds, const std::vector<int>& placementOrder,
+                            const cocos2d::Size& cardSize);
     void addDependency(int cardId, int coveredCardId);
     bool isCardCovered(int cardId) const;
     void removeCardFromPlayfield(int cardId);
     void restoreCardToPlayfield(int cardId); // 用于回退功能
 
+    // 变更事件：牌堆、覆盖、顶部牌状态每次改动时入队，视图每帧取出后只刷新受影响的卡牌
+    struct ChangeEvent {
+        enum class Type {
+            CARD_MOVED,        // 卡牌换了牌堆（主牌堆/备用牌堆/底牌堆）
+            COVER_CHANGED,     // 卡牌的覆盖状态可能改变
+            TOP_CARD_CHANGED   // 卡牌成为新的顶部牌
+        };
+        Type type;
+        int cardId;
+    };
+    // 层级表：缓存每张卡牌在底牌堆/主牌堆中的位置。单张卡牌进出牌堆时原地更新槽位，
+    // 整体载入（新关卡、存档）后标脏，下次查询时整表重建
+    int getCardZOrder(int cardId) const;
+    int getPlayfieldOrder(int cardId) const;  // 卡牌在主牌堆容器中的顺序，不在主牌堆返回-1
+    int getBottomPileOrder(int cardId) const; // 卡牌在底牌堆容器中的顺序，不在底牌堆返回-1
+
+    bool hasChangeEvents() const { return !_changeEvents.empty(); }
+    void drainChangeEvents(std::vector<ChangeEvent>& out);  // 取出并清空事件队列
+    void clearChangeEvents() { _changeEvents.clear(); }
+    // 无界面运行时没有视图消费事件，可关闭事件入队
+    void setChangeEventsEnabled(bool enabled);
+
 private:
+    void emitChange(ChangeEvent::Type type, int cardId);
+    void emitCoverChanges(int coveringCardId);  // 为coveringCardId覆盖的所有卡牌发出COVER_CHANGED
+
+    struct ZOrderSlot {
+        int playfieldIndex = -1;
+        int bottomIndex = -1;
+    };
+    const ZOrderSlot* findZOrderSlot(int cardId) const;
+    void rebuildZOrderSlots() const;
+    // 卡牌加入容器末尾或从index处移除后原地更新层级表；表已标脏时跳过，等下次查询整表重建
+    void onPlayfieldIdAppended(int cardId);
+    void onPlayfieldIdErased(int cardId, size_t index);
+    void onBottomIdAppended(int cardId);
+    void onBottomIdErased(int cardId, size_t index);
+
     std::unordered_map<int, CardModel> _allCards;
     std::vector<int> _playfieldCardIds;
     std::vector<int> _stackCardIds;
@@ -93,6 +140,12 @@ private:
     // 主牌堆依赖图和状态
     std::unordered_map<int, std::vector<int>> _dependencyGraph;  // 依赖图：卡牌ID -> 被覆盖的卡牌ID列表
     std::unordered_map<int, bool> _playfieldStatus;              // 主牌堆状态：卡牌ID -> 是否还在主牌堆
+
+    std::vector<ChangeEvent> _changeEvents;  // 尚未被视图消费的变更事件
+    bool _changeEventsEnabled;
+
+    mutable std::unordered_map<int, ZOrderSlot> _zOrderSlots;  // 卡牌ID -> 牌堆位置
+    mutable bool _zOrderTableDirty;
 };
 
 #endif // __GAME_MODEL_H__
\ No newline at end of file
@@ -1,10 +1,17 @@
 #include "UndoModel.h"
 #include "cocos2d.h"
+#include <algorithm>
 
 USING_NS_CC;
 
+const size_t UndoModel::MAX_STEPS;
+
 UndoModel::UndoModel(size_t maxSteps)
-    : _maxSteps(maxSteps) {
+    : _steps(maxSteps)
+    , _head(0)
+    , _count(0)
+    , _cursor(0)
+    , _maxSteps(maxSteps) {
     CCLOG("UndoModel created");
 }
 
@@ -13,41 +20,91 @@ UndoModel::~UndoModel() {
 }
 
 void UndoModel::addStep(const UndoStep& step) {
-    _undoSteps.push_back(step);
-    trimSteps();
+    if (_maxSteps == 0) {
+        return;
+    }
+
+    // 新操作截断重做分支
+    _count = _cursor;
+
+    if (_count == _maxSteps) {
+        // 已满：覆盖最早一步
+        _steps[_head] = step;
+        _head = (_head + 1) % _maxSteps;
+    } else {
+        _steps[slotOf(_count)] = step;
+        _count++;
+    }
+    _cursor = _count;
     CCLOG("Step added");
 }
 
-UndoStep UndoModel::popStep() {
-    if (_undoSteps.empty()) {
-        return UndoStep();
+const UndoStep* UndoModel::undoStep() {
+    if (_cursor == 0) {
+        return nullptr;
     }
 
-    UndoStep step = _undoSteps.back();
-    _undoSteps.pop_back();
+    _cursor--;
+    return &_steps[slotOf(_cursor)];
+}
+
+const UndoStep* UndoModel::redoStep() {
+    if (_cursor >= _count) {
+        return nullptr;
+    }
+
+    const UndoStep* step = &_steps[slotOf(_cursor)];
+    _cursor++;
     return step;
 }
 
+const UndoStep* UndoModel::peekRedoStep() const {
+    if (_cursor >= _count) {
+        return nullptr;
+    }
+    return &_steps[slotOf(_cursor)];
+}
+
 bool UndoModel::canUndo() const {
-    return !_undoSteps.empty();
+    return _cursor > 0;
+}
+
+bool UndoModel::canRedo() const {
+    return _cursor < _count;
 }
 
 size_t UndoModel::getStepCount() const {
-    return _undoSteps.size();
+    return _cursor;
+}
+
+size_t UndoModel::getRedoCount() const {
+    return _count - _cursor;
 }
 
 void UndoModel::clear() {
-    _undoSteps.clear();
+    _head = 0;
+    _count = 0;
+    _cursor = 0;
     CCLOG("UndoModel cleared");
 }
 
 void UndoModel::setMaxSteps(size_t maxSteps) {
+    // 保留最近的步骤，按时间顺序重新排列到新存储中
+    size_t keep = std::min(_count, maxSteps);
+    size_t dropped = _count - keep;
+
+    std::vector<UndoStep> steps(maxSteps);
+    for (size_t i = 0; i < keep; ++i) {
+        steps[i] = _steps[slotOf(dropped + i)];
+    }
+
+    _steps.swap(steps);
+    _cursor = _cursor > dropped ? _cursor - dropped : 0;
+    _head = 0;
+    _count = keep;
     _maxSteps = maxSteps;
-    trimSteps();
 }
 
-void UndoModel::trimSteps() {
-    if (_undoSteps.size() > _maxSteps) {
-        _undoSteps.erase(_undoSteps.begin(), _undoSteps.begin() + (_undoSteps.size() - _maxSteps));
-    }
+size_t UndoModel::slotOf(size_t index) const {
+    return (_head + index) % _maxSteps;
 }
\ No newline at end of file
@@ -42,24 +42,44 @@ struct UndoStep {
 /**
  * @class UndoModel
  * @brief ģͣ洢л˲
+ *
+ * ͬһ黷δ洢/ֻƶα꣬ҲUndoStep
+ * α֮¼²ʱп衣
  */
 class UndoModel {
+    friend class GameSnapshotService;
+
 public:
-    UndoModel(size_t maxSteps = 100);
+    // ıޣҲĬֵ浵гֵΪ
+    static const size_t MAX_STEPS = 100;
+
+    UndoModel(size_t maxSteps = MAX_STEPS);
     ~UndoModel();
 
-    // ӻ˲
+    // ӻ˲裨α֮Ŀ裩
     void addStep(const UndoStep& step);
 
-    // ȡƳһ
-    UndoStep popStep();
+    // һαˣر˵Ĳ裨޿ɻ˲ʱnullptr
+    const UndoStep* undoStep();
+
+    // һαǰرĲ裨޿ʱnullptr
+    const UndoStep* redoStep();
+
+    // 鿴һ裬ƶα
+    const UndoStep* peekRedoStep() const;
 
     // Ƿпɻ˲
     bool canUndo() const;
 
+    // Ƿп
+    bool canRedo() const;
+
     // ȡ˲
     size_t getStepCount() const;
 
+    // ȡ
+    size_t getRedoCount() const;
+
     // л˼¼
     void clear();
 
@@ -67,10 +87,13 @@ public:
     void setMaxSteps(size_t maxSteps);
 
 private:
-    // ƲƳ粽
-    void trimSteps();
+    // index0Ϊһڻδ洢еĲλ
+    size_t slotOf(size_t index) const;
 
-    std::vector<UndoStep> _undoSteps;   ///< ˲ջ
+    std::vector<UndoStep> _steps;       ///< δ洢̶Ϊ
+    size_t _head;                       ///< һڲλ
+    size_t _count;                      ///< Ѽ¼裩
+    size_t _cursor;                     ///< α꣺[0, _cursor)ɻˣ[_cursor, _count)
     size_t _maxSteps;                   ///< 
 };
 
@@ -2,8 +2,34 @@
 #include "../models/CardModel.h"
 #include "../models/GameModel.h"
 #include "../configs/models/LevelConfig.h"
+#include "../configs/loaders/LevelConfigLoader.h"
 #include "cocos2d.h"
 
+const int GameModelFromLevelGenerator::FIRST_CARD_ID;
+
+namespace {
+
+/**
+ * @brief 初始化备用牌堆和底牌堆：全部备用牌入栈，并自动弹出第一张作为底牌
+ */
+void initializePiles(GameModel& gameModel) {
+    const auto& stackCards = gameModel.getStackCardIds();
+    
+    // 将所有备用牌添加到栈中
+    for (int stackCardId : stackCards) {
+        gameModel.pushToStackPile(stackCardId);
+    }
+    
+    // 自动弹栈：将备用牌堆的第一张牌弹到底牌堆
+    if (!gameModel.isStackPileEmpty()) {
+        int firstStackCard = gameModel.popFromStackPile();
+        gameModel.pushToBottomPile(firstStackCard);
+        gameModel.setTopCard(firstStackCard);
+    }
+}
+
+} // namespace
+
 GameModel GameModelFromLevelGenerator::generateGameModel(const LevelConfig& levelConfig) {
     GameModel gameModel;
     
@@ -14,7 +40,7 @@ GameModel GameModelFromLevelGenerator::generateGameModel(const LevelConfig& leve
     }
     
     // 生成主牌堆卡牌
-    int cardId = 1000;
+    int cardId = FIRST_CARD_ID;
     for (const auto& cardConfig : levelConfig.playfieldCards) {
         CardModel card(cardId,
                       cardConfig.face,
@@ -40,24 +66,75 @@ GameModel GameModelFromLevelGenerator::generateGameModel(const LevelConfig& leve
     
     // 初始化备用牌堆和底牌堆
     if (!levelConfig.stackCards.empty()) {
-        const auto& stackCards = gameModel.getStackCardIds();
-        
-        // 将所有备用牌添加到栈中
-        for (int stackCardId : stackCards) {
-            gameModel.pushToStackPile(stackCardId);
-        }
-        
-        // 自动弹栈：将备用牌堆的第一张牌弹到底牌堆
-        if (!gameModel.isStackPileEmpty()) {
-            int firstStackCard = gameModel.popFromStackPile();
-            gameModel.pushToBottomPile(firstStackCard);
-            gameModel.setTopCard(firstStackCard);
+        initializePiles(gameModel);
+    }
+    
+    return gameModel;
+}
+
+GameModel GameModelFromLevelGenerator::generateGameModel(const CompiledLevel& compiledLevel) {
+    GameModel gameModel;
+    
+    // 校验在编译阶段完成，这里只读取结果
+    if (!compiledLevel.isValid() || !compiledLevel.isValidated()) {
+        CCLOGERROR("Invalid compiled level %d", compiledLevel.getLevelId());
+        return gameModel;
+    }
+    
+    const CompiledLevel::Card* cards = compiledLevel.getCards();
+    uint32_t playfieldCount = compiledLevel.getPlayfieldCount();
+    uint32_t cardCount = playfieldCount + compiledLevel.getStackCount();
+    
+    // 卡牌ID分配规则与JSON路径一致
+    const int firstCardId = FIRST_CARD_ID;
+    for (uint32_t i = 0; i < cardCount; ++i) {
+        const CompiledLevel::Card& cardData = cards[i];
+        bool isPlayfield = i < playfieldCount;
+        CardModel card(firstCardId + (int)i,
+                      static_cast<CardFaceType>(cardData.face),
+                      static_cast<CardSuitType>(cardData.suit),
+                      cocos2d::Vec2(cardData.x, cardData.y));
+        card.setCovered(cardData.isCovered != 0);
+        card.setIsInPlayfield(isPlayfield);
+        gameModel.addCard(card, isPlayfield);
+    }
+    
+    if (cardCount > playfieldCount) {
+        initializePiles(gameModel);
+    }
+    
+    // 直接写入预计算的覆盖关系
+    gameModel.clearDependencyGraph();
+    const uint32_t* coverIndices = compiledLevel.getCoverIndices();
+    for (uint32_t i = 0; i < playfieldCount; ++i) {
+        const CompiledLevel::Card& cardData = cards[i];
+        for (uint32_t k = 0; k < cardData.coverCount; ++k) {
+            gameModel.addDependency(firstCardId + (int)i, firstCardId + (int)coverIndices[cardData.coverBegin + k]);
         }
     }
     
     return gameModel;
 }
 
+GameModel GameModelFromLevelGenerator::generateGameModelForLevel(int levelId, const cocos2d::Size& cardSize,
+                                                                bool& dependencyGraphReady) {
+    // 优先使用预编译关卡：免去JSON解析、配置校验和依赖图构建
+    CompiledLevel compiledLevel;
+    if (LevelConfigLoader::loadCompiledLevel(levelId, compiledLevel)) {
+        // 覆盖关系按编译时的卡牌尺寸计算，美术资源变化后需重新编译
+        if (compiledLevel.getCardSize().equals(cardSize)) {
+            dependencyGraphReady = true;
+            return generateGameModel(compiledLevel);
+        }
+        CCLOG("Compiled level %d is stale (card size %.1f x %.1f, expected %.1f x %.1f), falling back to JSON",
+              levelId, compiledLevel.getCardSize().width, compiledLevel.getCardSize().height,
+              cardSize.width, cardSize.height);
+    }
+    
+    dependencyGraphReady = false;
+    return generateGameModel(LevelConfigLoader::loadLevelConfig(levelId));
+}
+
 bool GameModelFromLevelGenerator::validateLevelConfig(const LevelConfig& levelConfig) {
     // 检查是否有卡牌
     if (levelConfig.playfieldCards.empty() && levelConfig.stackCards.empty()) {
@@ -2,6 +2,7 @@
 #define __GAME_MODEL_FROM_LEVEL_GENERATOR_H__
 
 #include "../configs/models/LevelConfig.h"
+#include "../configs/models/CompiledLevel.h"
 #include "../models/GameModel.h"
 
 /**
@@ -15,6 +16,9 @@
  */
 class GameModelFromLevelGenerator {
 public:
+    // 卡牌ID分配规则：从FIRST_CARD_ID开始，先主牌堆后备用牌堆，按配置顺序递增
+    static const int FIRST_CARD_ID = 1000;
+    
     /**
      * @brief 从关卡配置生成游戏模型
      * @param levelConfig 关卡配置
@@ -22,6 +26,27 @@ public:
      */
     static GameModel generateGameModel(const LevelConfig& levelConfig);
     
+    /**
+     * @brief 从预编译关卡生成游戏模型
+     * 
+     * 校验结果和覆盖关系已在离线编译时算好，这里直接写入依赖图，
+     * 视图初始化时无需再做包围盒碰撞检测。
+     * @param compiledLevel 预编译关卡
+     * @return 生成的游戏模型（依赖图已填充）
+     */
+    static GameModel generateGameModel(const CompiledLevel& compiledLevel);
+    
+    /**
+     * @brief 按关卡ID加载并生成游戏模型，优先使用预编译关卡，否则解析JSON配置
+     * 
+     * 不访问任何视图或纹理，可在后台线程调用。
+     * @param levelId 关卡ID
+     * @param cardSize 当前卡牌尺寸，与预编译时的尺寸不一致则退回JSON
+     * @param dependencyGraphReady 输出：依赖图是否已由预编译数据填充
+     * @return 生成的游戏模型
+     */
+    static GameModel generateGameModelForLevel(int levelId, const cocos2d::Size& cardSize, bool& dependencyGraphReady);
+    
     /**
      * @brief 验证关卡配置的有效性
      * @param levelConfig 关卡配置
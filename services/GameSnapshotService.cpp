@@ -0,0 +1,381 @@
+#include "GameSnapshotService.h"
+#include "../models/CardModel.h"
+#include "cocos2d.h"
+#include <cstdio>
+#include <cstring>
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+namespace {
+
+const char SNAPSHOT_MAGIC[4] = { 'C', 'E', 'S', 'V' };
+const uint32_t SNAPSHOT_VERSION = 1;
+
+// 存档各段均为定长POD记录，读写只需memcpy
+struct SnapshotHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t totalSize;
+    int32_t levelId;
+    uint32_t sessionId;
+    uint32_t journalEntryCount;
+    int32_t topCardId;
+    int32_t gameState;
+    int32_t score;
+    int32_t moveCount;
+    uint32_t cardCount;
+    uint32_t playfieldCount;
+    uint32_t stackCount;
+    uint32_t bottomCount;
+    uint32_t stackPileCount;
+    uint32_t bottomPileCount;
+    uint32_t dependencyEdgeCount;
+    uint32_t playfieldStatusCount;
+    uint32_t undoMaxSteps;
+    uint32_t undoCount;
+    uint32_t undoCursor;
+};
+
+struct CardRecord {
+    int32_t cardId;
+    int32_t face;
+    int32_t suit;
+    float x;
+    float y;
+    int32_t zOrder;
+    uint8_t covered;
+    uint8_t inPlayfield;
+    uint8_t padding[2];
+};
+
+struct IdPairRecord {
+    int32_t first;
+    int32_t second;
+};
+
+struct UndoStepRecord {
+    int32_t actionType;
+    int32_t cardId1;
+    int32_t cardId2;
+    float x1;
+    float y1;
+    float x2;
+    float y2;
+    int32_t zOrder1;
+    int32_t zOrder2;
+    uint8_t wasCovered1;
+    uint8_t wasCovered2;
+    uint8_t wasInPlayfield1;
+    uint8_t wasInPlayfield2;
+};
+
+static_assert(sizeof(int) == sizeof(int32_t), "card id vectors are copied as int32 arrays");
+
+template <typename T>
+void appendRecords(std::vector<unsigned char>& buffer, const T* records, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(T) * count);
+    memcpy(buffer.data() + offset, records, sizeof(T) * count);
+}
+
+/**
+ * @brief 带越界检查的顺序读取器
+ */
+class SnapshotReader {
+public:
+    SnapshotReader(const unsigned char* data, size_t size) : _data(data), _size(size), _offset(0) {}
+
+    template <typename T>
+    bool read(T* records, size_t count) {
+        size_t bytes = sizeof(T) * count;
+        if (bytes > _size - _offset) {
+            return false;
+        }
+        if (bytes > 0) {
+            memcpy(records, _data + _offset, bytes);
+        }
+        _offset += bytes;
+        return true;
+    }
+
+    template <typename T>
+    bool readVector(std::vector<T>& out, size_t count) {
+        if (sizeof(T) * count > _size - _offset) {
+            return false;
+        }
+        out.resize(count);
+        return read(out.data(), count);
+    }
+
+    bool atEnd() const { return _offset == _size; }
+
+private:
+    const unsigned char* _data;
+    size_t _size;
+    size_t _offset;
+};
+
+} // namespace
+
+void GameSnapshotService::serialize(const GameModel& gameModel, const UndoModel& undoModel,
+                                    const SnapshotInfo& info, std::vector<unsigned char>& buffer) {
+    size_t edgeCount = 0;
+    for (const auto& pair : gameModel._dependencyGraph) {
+        edgeCount += pair.second.size();
+    }
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.levelId = info.levelId;
+    header.sessionId = info.sessionId;
+    header.journalEntryCount = info.journalEntryCount;
+    header.topCardId = gameModel._currentTopCardId;
+    header.gameState = static_cast<int32_t>(gameModel._gameState);
+    header.score = gameModel._score;
+    header.moveCount = gameModel._moveCount;
+    header.cardCount = (uint32_t)gameModel._allCards.size();
+    header.playfieldCount = (uint32_t)gameModel._playfieldCardIds.size();
+    header.stackCount = (uint32_t)gameModel._stackCardIds.size();
+    header.bottomCount = (uint32_t)gameModel._bottomCardIds.size();
+    header.stackPileCount = (uint32_t)gameModel._stackPile.size();
+    header.bottomPileCount = (uint32_t)gameModel._bottomPile.size();
+    header.dependencyEdgeCount = (uint32_t)edgeCount;
+    header.playfieldStatusCount = (uint32_t)gameModel._playfieldStatus.size();
+    header.undoMaxSteps = (uint32_t)undoModel._maxSteps;
+    header.undoCount = (uint32_t)undoModel._count;
+    header.undoCursor = (uint32_t)undoModel._cursor;
+
+    header.totalSize = (uint32_t)(sizeof(SnapshotHeader)
+        + sizeof(CardRecord) * header.cardCount
+        + sizeof(int32_t) * (header.playfieldCount + header.stackCount + header.bottomCount
+                             + header.stackPileCount + header.bottomPileCount)
+        + sizeof(IdPairRecord) * (header.dependencyEdgeCount + header.playfieldStatusCount)
+        + sizeof(UndoStepRecord) * header.undoCount);
+
+    buffer.clear();
+    buffer.reserve(header.totalSize);
+    appendRecords(buffer, &header, 1);
+
+    // 卡牌
+    for (const auto& pair : gameModel._allCards) {
+        const CardModel& card = pair.second;
+        CardRecord record;
+        memset(&record, 0, sizeof(record));
+        record.cardId = card.getCardId();
+        record.face = card.getFace();
+        record.suit = card.getSuit();
+        record.x = card.getPosition().x;
+        record.y = card.getPosition().y;
+        record.zOrder = card.getZOrder();
+        record.covered = card.isCovered() ? 1 : 0;
+        record.inPlayfield = card.isInPlayfield() ? 1 : 0;
+        appendRecords(buffer, &record, 1);
+    }
+
+    // 各牌堆
+    appendRecords(buffer, gameModel._playfieldCardIds.data(), gameModel._playfieldCardIds.size());
+    appendRecords(buffer, gameModel._stackCardIds.data(), gameModel._stackCardIds.size());
+    appendRecords(buffer, gameModel._bottomCardIds.data(), gameModel._bottomCardIds.size());
+    appendRecords(buffer, gameModel._stackPile.data(), gameModel._stackPile.size());
+    appendRecords(buffer, gameModel._bottomPile.data(), gameModel._bottomPile.size());
+
+    // 依赖图（展开为覆盖者-被覆盖者对）
+    for (const auto& pair : gameModel._dependencyGraph) {
+        for (int coveredCardId : pair.second) {
+            IdPairRecord record = { pair.first, coveredCardId };
+            appendRecords(buffer, &record, 1);
+        }
+    }
+    for (const auto& pair : gameModel._playfieldStatus) {
+        IdPairRecord record = { pair.first, pair.second ? 1 : 0 };
+        appendRecords(buffer, &record, 1);
+    }
+
+    // 回退历史按时间顺序写出（含可重做步骤）
+    for (size_t i = 0; i < undoModel._count; ++i) {
+        const UndoStep& step = undoModel._steps[undoModel.slotOf(i)];
+        UndoStepRecord record;
+        memset(&record, 0, sizeof(record));
+        record.actionType = static_cast<int32_t>(step.actionType);
+        record.cardId1 = step.cardId1;
+        record.cardId2 = step.cardId2;
+        record.x1 = step.originalPos1.x;
+        record.y1 = step.originalPos1.y;
+        record.x2 = step.originalPos2.x;
+        record.y2 = step.originalPos2.y;
+        record.zOrder1 = step.zOrder1;
+        record.zOrder2 = step.zOrder2;
+        record.wasCovered1 = step.wasCovered1 ? 1 : 0;
+        record.wasCovered2 = step.wasCovered2 ? 1 : 0;
+        record.wasInPlayfield1 = step.wasInPlayfield1 ? 1 : 0;
+        record.wasInPlayfield2 = step.wasInPlayfield2 ? 1 : 0;
+        appendRecords(buffer, &record, 1);
+    }
+
+    CCLOG("GameSnapshotService: serialized %d cards, %d undo steps into %d bytes",
+          (int)header.cardCount, (int)header.undoCount, (int)buffer.size());
+}
+
+bool GameSnapshotService::deserialize(const unsigned char* data, size_t size,
+                                      GameModel& gameModel, UndoModel& undoModel, SnapshotInfo& info) {
+    SnapshotReader reader(data, size);
+
+    SnapshotHeader header;
+    if (!reader.read(&header, 1)) {
+        CCLOGERROR("GameSnapshotService: snapshot too small");
+        return false;
+    }
+    if (memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != SNAPSHOT_VERSION || header.totalSize != size) {
+        CCLOGERROR("GameSnapshotService: unsupported snapshot (version %u)", header.version);
+        return false;
+    }
+    // 回退容量决定setMaxSteps的分配大小，不能信任文件中的任意值
+    if (header.undoMaxSteps > UndoModel::MAX_STEPS) {
+        CCLOGERROR("GameSnapshotService: undo capacity %u exceeds limit %u",
+                   header.undoMaxSteps, (unsigned)UndoModel::MAX_STEPS);
+        return false;
+    }
+    if (header.undoCount > header.undoMaxSteps || header.undoCursor > header.undoCount) {
+        CCLOGERROR("GameSnapshotService: corrupt undo history");
+        return false;
+    }
+
+    // 卡牌
+    std::vector<CardRecord> cards;
+    if (!reader.readVector(cards, header.cardCount)) {
+        return false;
+    }
+    gameModel._allCards.clear();
+    gameModel._allCards.reserve(cards.size());
+    for (const CardRecord& record : cards) {
+        CardModel card(record.cardId,
+                       static_cast<CardFaceType>(record.face),
+                       static_cast<CardSuitType>(record.suit),
+                       Vec2(record.x, record.y));
+        card.setCovered(record.covered != 0);
+        card.setIsInPlayfield(record.inPlayfield != 0);
+        card.setZOrder(record.zOrder);
+        gameModel._allCards.emplace(record.cardId, card);
+    }
+
+    // 各牌堆直接整段拷贝
+    if (!reader.readVector(gameModel._playfieldCardIds, header.playfieldCount) ||
+        !reader.readVector(gameModel._stackCardIds, header.stackCount) ||
+        !reader.readVector(gameModel._bottomCardIds, header.bottomCount) ||
+        !reader.readVector(gameModel._stackPile, header.stackPileCount) ||
+        !reader.readVector(gameModel._bottomPile, header.bottomPileCount)) {
+        CCLOGERROR("GameSnapshotService: truncated pile data");
+        return false;
+    }
+    gameModel._zOrderTableDirty = true;
+
+    // 依赖图
+    std::vector<IdPairRecord> pairs;
+    if (!reader.readVector(pairs, header.dependencyEdgeCount)) {
+        return false;
+    }
+    gameModel._dependencyGraph.clear();
+    for (const IdPairRecord& record : pairs) {
+        gameModel._dependencyGraph[record.first].push_back(record.second);
+    }
+    if (!reader.readVector(pairs, header.playfieldStatusCount)) {
+        return false;
+    }
+    gameModel._playfieldStatus.clear();
+    gameModel._playfieldStatus.reserve(pairs.size());
+    for (const IdPairRecord& record : pairs) {
+        gameModel._playfieldStatus[record.first] = record.second != 0;
+    }
+
+    // 回退历史
+    std::vector<UndoStepRecord> steps;
+    if (!reader.readVector(steps, header.undoCount) || !reader.atEnd()) {
+        CCLOGERROR("GameSnapshotService: truncated undo history");
+        return false;
+    }
+    undoModel.setMaxSteps(header.undoMaxSteps);
+    undoModel.clear();
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const UndoStepRecord& record = steps[i];
+        UndoStep& step = undoModel._steps[i];
+        step.actionType = static_cast<UndoActionType>(record.actionType);
+        step.cardId1 = record.cardId1;
+        step.cardId2 = record.cardId2;
+        step.originalPos1 = Vec2(record.x1, record.y1);
+        step.originalPos2 = Vec2(record.x2, record.y2);
+        step.zOrder1 = record.zOrder1;
+        step.zOrder2 = record.zOrder2;
+        step.wasCovered1 = record.wasCovered1 != 0;
+        step.wasCovered2 = record.wasCovered2 != 0;
+        step.wasInPlayfield1 = record.wasInPlayfield1 != 0;
+        step.wasInPlayfield2 = record.wasInPlayfield2 != 0;
+    }
+    undoModel._count = header.undoCount;
+    undoModel._cursor = header.undoCursor;
+
+    gameModel._currentTopCardId = header.topCardId;
+    gameModel._gameState = static_cast<GameModel::GameState>(header.gameState);
+    gameModel._score = header.score;
+    gameModel._moveCount = header.moveCount;
+
+    info.levelId = header.levelId;
+    info.sessionId = header.sessionId;
+    info.journalEntryCount = header.journalEntryCount;
+
+    CCLOG("GameSnapshotService: restored %d cards, %d undo steps", (int)header.cardCount, (int)header.undoCount);
+    return true;
+}
+
+bool GameSnapshotService::writeToFile(const std::vector<unsigned char>& buffer, const std::string& path) {
+    std::string tempPath = path + ".tmp";
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (!file) {
+        CCLOGERROR("GameSnapshotService: failed to create %s", tempPath.c_str());
+        return false;
+    }
+
+    // 临时文件落盘后再替换，崩溃时旧存档或新存档至少有一个完整
+    size_t written = fwrite(buffer.data(), 1, buffer.size(), file);
+    bool flushed = fflush(file) == 0;
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
+    flushed = flushed && _commit(_fileno(file)) == 0;
+#else
+    flushed = flushed && fsync(fileno(file)) == 0;
+#endif
+    fclose(file);
+    if (written != buffer.size() || !flushed) {
+        CCLOGERROR("GameSnapshotService: short write to %s", tempPath.c_str());
+        remove(tempPath.c_str());
+        return false;
+    }
+
+    // 原子替换：不先删除旧存档，替换过程中崩溃时旧存档仍完整
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
+    bool replaced = MoveFileExA(tempPath.c_str(), path.c_str(),
+                                MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    bool replaced = rename(tempPath.c_str(), path.c_str()) == 0;
+#endif
+    if (!replaced) {
+        CCLOGERROR("GameSnapshotService: failed to replace %s", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::string GameSnapshotService::getDefaultPath() {
+    return FileUtils::getInstance()->getWritablePath() + "session.snapshot";
+}
\ No newline at end of file
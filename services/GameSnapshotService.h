@@ -0,0 +1,72 @@
+#ifndef __GAME_SNAPSHOT_SERVICE_H__
+#define __GAME_SNAPSHOT_SERVICE_H__
+
+#include "../models/GameModel.h"
+#include "../models/UndoModel.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class GameSnapshotService
+ * @brief 将完整对局（GameModel + 回退历史）序列化为紧凑二进制存档的服务
+ * 
+ * 职责：
+ * - 把卡牌状态、各牌堆、顶部牌、分数、步数、依赖图和回退历史写成定长记录
+ * - 读取时只做校验和memcpy，不做任何文本解析
+ * - 提供无状态的服务，不管理数据生命周期
+ * 
+ * 存档格式带版本号，版本不一致的存档直接视为无效。
+ */
+class GameSnapshotService {
+public:
+    /**
+     * @struct SnapshotInfo
+     * @brief 存档附带的会话信息
+     */
+    struct SnapshotInfo {
+        int levelId;
+        uint32_t sessionId;             ///< 对应操作日志的会话ID
+        uint32_t journalEntryCount;     ///< 存档时日志中的记录数
+
+        SnapshotInfo() : levelId(0), sessionId(0), journalEntryCount(0) {}
+    };
+
+    /**
+     * @brief 序列化对局
+     * @param gameModel 游戏模型
+     * @param undoModel 回退历史
+     * @param info 会话信息
+     * @param buffer 输出缓冲区
+     */
+    static void serialize(const GameModel& gameModel, const UndoModel& undoModel,
+                          const SnapshotInfo& info, std::vector<unsigned char>& buffer);
+
+    /**
+     * @brief 反序列化对局
+     * @param data 存档数据
+     * @param size 数据长度
+     * @param gameModel 输出：游戏模型（应为新建的空模型）
+     * @param undoModel 输出：回退历史
+     * @param info 输出：会话信息
+     * @return 存档是否有效
+     */
+    static bool deserialize(const unsigned char* data, size_t size,
+                            GameModel& gameModel, UndoModel& undoModel, SnapshotInfo& info);
+
+    /**
+     * @brief 原子写入存档文件（先写临时文件并落盘，再覆盖式重命名替换）
+     * @param buffer 存档数据
+     * @param path 文件路径
+     * @return 是否写入成功
+     */
+    static bool writeToFile(const std::vector<unsigned char>& buffer, const std::string& path);
+
+    /**
+     * @brief 获取默认存档路径（可写目录下）
+     * @return 存档路径
+     */
+    static std::string getDefaultPath();
+};
+
+#endif // __GAME_SNAPSHOT_SERVICE_H__
\ No newline at end of file
@@ -0,0 +1,307 @@
+/**
+ * @file MoveAllocationBench.cpp
+ * @brief 无界面出牌路径的内存分配计数
+ *
+ * 职责：
+ * - 用真实的CardController、UndoController、UndoManager和GameModel全速执行出牌、回退、前进
+ * - 视图换成HeadlessBoardView：模型变更事件保持开启，每步之后按GameView::syncDirtyCardViews的流程
+ *   取出事件（共用DirtyCardTracker）、逐张同步脏卡牌、刷新顶部牌（updateTopCardDisplay）
+ * - 预热一轮后统计测量轮中全局operator new的调用次数，任何一步有分配即返回非零
+ *
+ * 测量范围：控制器、模型、变更事件、脏卡牌记录、视图表查找，以及视图同步中的位置（BoardLayout）和
+ * 层级（GameUtils）查询。不包括cocos2d节点本身的属性修改、子节点重排和精灵帧切换，这些需要OpenGL上下文；
+ * 也不包括补间动画（无界面视图不播放动画，控制器按立即完成处理）。
+ *
+ * 与游戏源文件、cocos2d库一起编译为命令行程序，使用发布配置（CCLOG不格式化字符串）：
+ *     MoveAllocationBench [rounds]
+ * 每轮：贪心出牌直到无牌可出，全部回退，全部前进，再全部回退回到开局。
+ */
+
+#include "../../controllers/CardController.h"
+#include "../../controllers/UndoController.h"
+#include "../../managers/UndoManager.h"
+#include "../../models/GameModel.h"
+#include "../../services/GameModelFromLevelGenerator.h"
+#include "../../utils/GameUtils.h"
+#include "../../views/BoardLayout.h"
+#include "../../views/DirtyCardTracker.h"
+#include "../../views/GameViewInterface.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <unordered_map>
+
+namespace {
+
+std::atomic<long long> g_allocationCount(0);
+
+void* countedAlloc(std::size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    void* p = countedAlloc(size);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+const int DEFAULT_ROUNDS = 1000;
+
+LevelConfig::CardConfig makeCard(CardFaceType face, CardSuitType suit, float x, float y) {
+    LevelConfig::CardConfig card;
+    card.face = face;
+    card.suit = suit;
+    card.position = cocos2d::Vec2(x, y);
+    return card;
+}
+
+/**
+ * @brief 构造固定关卡：主牌堆为2-7和9-K两段，备用牌堆依次提供A（开局底牌）、8、Q，
+ *        一轮贪心出牌包含主牌堆匹配和备用牌堆抽牌两种操作
+ */
+LevelConfig makeBenchLevel() {
+    LevelConfig config;
+    config.levelId = 0;
+    config.levelName = "alloc_bench";
+
+    float x = 100.0f;
+    for (int face = CFT_TWO; face <= CFT_KING; ++face) {
+        if (face == CFT_EIGHT) {
+            continue;
+        }
+        config.playfieldCards.push_back(makeCard((CardFaceType)face, CST_HEARTS, x, 1500.0f));
+        x += 200.0f;
+    }
+
+    // 初始化时弹出末尾一张作为底牌，其余从后往前抽
+    config.stackCards.push_back(makeCard(CFT_QUEEN, CST_SPADES, 0, 0));
+    config.stackCards.push_back(makeCard(CFT_EIGHT, CST_CLUBS, 0, 0));
+    config.stackCards.push_back(makeCard(CFT_ACE, CST_DIAMONDS, 0, 0));
+    return config;
+}
+
+/**
+ * @brief 无界面的棋盘视图：与GameView相同的同步流程和查询，只是把结果记在普通结构里而不是cocos2d节点上
+ */
+class HeadlessBoardView : public GameViewInterface {
+public:
+    HeadlessBoardView() : _model(nullptr) {}
+
+    // 对应GameView::initializeWithModel：按模型建立视图表和位置表
+    void initializeWithModel(GameModel& model) {
+        _model = &model;
+        _boardLayout.build(model);
+        _cardViews.clear();
+        for (const auto& pair : model.getAllCards()) {
+            _cardViews[pair.first] = CardSlot();
+        }
+        _dirtyCards.clear();
+        model.clearChangeEvents();
+        updateTopCardDisplay();
+    }
+
+    // 对应GameView::syncDirtyCardViews（无动画，脏卡牌全部立即同步）
+    void syncDirtyCardViews() {
+        _dirtyCards.collect(*_model);
+        if (_dirtyCards.empty()) {
+            return;
+        }
+        _dirtyCards.consume([this](int cardId) {
+            updateCardView(cardId);
+            return true;
+        });
+        if (_dirtyCards.isTopCardDirty()) {
+            updateTopCardDisplay();
+            _dirtyCards.clearTopCardDirty();
+        }
+    }
+
+    // 所有卡牌当前层级之和，防止查询被优化掉，也可用于比对不同版本的结果
+    int checksum() const {
+        int sum = 0;
+        for (const auto& pair : _cardViews) {
+            sum += pair.second.zOrder;
+        }
+        return sum;
+    }
+
+    bool playCardMoveToTopAnimation(int /*cardId*/, const cocos2d::Vec2& /*originalPosition*/) override { return false; }
+    bool playCardReturnAnimation(int /*cardId*/) override { return false; }
+    bool isPlayingReturnAnimations() const override { return false; }
+    void setReturnAnimationsCompletedCallback(const std::function<void()>& /*callback*/) override {}
+
+    void refreshCardDisplay(int cardId) override {
+        findCardView(cardId);
+    }
+
+    // 对应GameView::updateTopCardDisplay
+    void updateTopCardDisplay() override {
+        const CardModel* topCard = _model ? _model->getTopCard() : nullptr;
+        CardSlot* slot = topCard ? findCardView(topCard->getCardId()) : nullptr;
+        if (slot) {
+            slot->position = BoardLayout::getBottomSlot();
+            slot->zOrder = GameUtils::calculateCorrectZOrder(topCard->getCardId(), _model);
+        }
+    }
+
+    // 对应GameView::restoreCardZOrders
+    void restoreCardZOrders() override {
+        for (auto& pair : _cardViews) {
+            pair.second.zOrder = GameUtils::calculateCorrectZOrder(pair.first, _model);
+        }
+    }
+
+private:
+    struct CardSlot {
+        cocos2d::Vec2 position;
+        int zOrder = 0;
+    };
+
+    CardSlot* findCardView(int cardId) {
+        auto it = _cardViews.find(cardId);
+        return it != _cardViews.end() ? &it->second : nullptr;
+    }
+
+    // 对应GameView::updateCardView
+    void updateCardView(int cardId) {
+        CardSlot* slot = findCardView(cardId);
+        if (!slot) {
+            return;
+        }
+        slot->position = _boardLayout.getPosition(cardId, *_model);
+        slot->zOrder = GameUtils::calculateSyncZOrder(cardId, _model);
+    }
+
+    GameModel* _model;
+    std::unordered_map<int, CardSlot> _cardViews;   // 对应GameView::_cardViews
+    BoardLayout _boardLayout;
+    DirtyCardTracker _dirtyCards;
+};
+
+/**
+ * @brief 一步操作之后的一帧：同步视图并累加校验值
+ */
+void endFrame(HeadlessBoardView& view, int& checksumSink) {
+    view.syncDirtyCardViews();
+    checksumSink += view.checksum();
+}
+
+/**
+ * @brief 贪心出牌：优先匹配主牌堆，无牌可配时从备用牌堆抽牌
+ * @return 执行的操作数
+ */
+int playGreedy(GameModel& gameModel, CardController& cardController, HeadlessBoardView& view, int& checksumSink) {
+    int moves = 0;
+    for (;;) {
+        bool moved = false;
+        const std::vector<int>& playfield = gameModel.getPlayfieldCardIds();
+        for (size_t i = 0; i < playfield.size() && !moved; ++i) {
+            moved = cardController.handleCardClick(playfield[i]);
+        }
+
+        if (!moved) {
+            int stackTop = gameModel.getStackPileTop();
+            moved = stackTop != -1 && cardController.handleCardClick(stackTop);
+        }
+
+        if (!moved) {
+            return moves;
+        }
+        endFrame(view, checksumSink);
+        moves++;
+    }
+}
+
+int undoAll(UndoController& undoController, HeadlessBoardView& view, int& checksumSink) {
+    int moves = 0;
+    while (undoController.executeUndo()) {
+        endFrame(view, checksumSink);
+        moves++;
+    }
+    return moves;
+}
+
+int redoAll(UndoController& undoController, HeadlessBoardView& view, int& checksumSink) {
+    int moves = 0;
+    while (undoController.executeRedo()) {
+        endFrame(view, checksumSink);
+        moves++;
+    }
+    return moves;
+}
+
+int runRound(GameModel& gameModel, CardController& cardController, UndoController& undoController,
+             HeadlessBoardView& view, int& checksumSink) {
+    int moves = playGreedy(gameModel, cardController, view, checksumSink);
+    moves += undoAll(undoController, view, checksumSink);
+    moves += redoAll(undoController, view, checksumSink);
+    moves += undoAll(undoController, view, checksumSink);
+    return moves;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int rounds = argc > 1 ? std::atoi(argv[1]) : DEFAULT_ROUNDS;
+    if (rounds <= 0) {
+        rounds = DEFAULT_ROUNDS;
+    }
+
+    GameModel gameModel = GameModelFromLevelGenerator::generateGameModel(makeBenchLevel());
+    gameModel.clearDependencyGraph();
+    gameModel.setGameState(GameModel::GameState::PLAYING);
+
+    UndoManager undoManager;
+    undoManager.init(&gameModel);
+
+    HeadlessBoardView view;
+    view.initializeWithModel(gameModel);
+
+    CardController cardController;
+    cardController.init(&gameModel, &view, &undoManager);
+    UndoController undoController;
+    undoController.init(&gameModel, &view, &undoManager);
+
+    // 预热一轮：容器、层级表、事件缓冲区和回退存储在这一轮中达到最终容量
+    int checksumSink = 0;
+    int warmupMoves = runRound(gameModel, cardController, undoController, view, checksumSink);
+    if (warmupMoves == 0) {
+        std::fprintf(stderr, "MoveAllocationBench: bench level produced no moves\n");
+        return 2;
+    }
+
+    long long before = g_allocationCount.load();
+    long long moves = 0;
+    for (int i = 0; i < rounds; ++i) {
+        moves += runRound(gameModel, cardController, undoController, view, checksumSink);
+    }
+    long long allocations = g_allocationCount.load() - before;
+
+    std::printf("MoveAllocationBench: %d rounds, %lld moves, %lld allocations (%.3f per move), checksum %d\n",
+                rounds, moves, allocations, moves > 0 ? (double)allocations / moves : 0.0, checksumSink);
+    return allocations == 0 ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+关卡离线编译器：将 configs/levels/Level_XX_config.json 编译为定长二进制 Level_XX.lvb，
+或（--pack）打包为单个关卡包 levels.lvpk
+
+编译产物包含卡牌表、预计算的覆盖关系（依赖图）以及校验结果，
+运行时由 LevelConfigLoader::loadCompiledLevel 直接映射使用，布局见 configs/models/CompiledLevel.h。
+关卡包布局见 configs/models/LevelPack.h：头部 + 按关卡ID排列的索引表 + 各关卡记录，运行时只映射一次。
+
+覆盖关系依赖卡牌尺寸（res/card_general.png 的像素尺寸），美术资源变化后需重新编译；
+运行时发现尺寸不一致会自动退回JSON路径。
+
+用法：
+    python3 tools/compile_levels.py --card-width W --card-height H [--levels-dir configs/levels] [--pack]
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import struct
+import sys
+
+MAGIC = 0x564C4543  # "CELV"
+VERSION = 1
+FLAG_VALIDATED = 1 << 0
+
+PACK_MAGIC = 0x504C4543  # "CELP"
+PACK_VERSION = 1
+PACK_FILE_NAME = "levels.lvpk"
+
+CARD_FACE_COUNT = 13  # CFT_NUM_CARD_FACE_TYPES
+CARD_SUIT_COUNT = 4   # CST_NUM_CARD_SUIT_TYPES
+
+HEADER_FORMAT = "<IIiIffIIIIII"
+CARD_FORMAT = "<iiffIII"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+CARD_SIZE = struct.calcsize(CARD_FORMAT)
+PACK_HEADER_FORMAT = "<IIiIII"
+PACK_INDEX_FORMAT = "<II"
+
+LEVEL_FILE_PATTERN = re.compile(r"Level_(\d+)_config\.json$")
+
+
+def read_cards(section):
+    cards = []
+    for entry in section or []:
+        position = entry.get("Position", {})
+        cards.append({
+            "face": int(entry.get("CardFace", -1)),
+            "suit": int(entry.get("CardSuit", -1)),
+            "x": float(position.get("x", 0)),
+            "y": float(position.get("y", 0)),
+        })
+    return cards
+
+
+def validate(playfield, stack):
+    """与 GameModelFromLevelGenerator::validateLevelConfig 规则一致"""
+    if not playfield and not stack:
+        return False, "level has no cards"
+    for name, cards in (("playfield", playfield), ("stack", stack)):
+        for card in cards:
+            if not (0 <= card["face"] < CARD_FACE_COUNT and 0 <= card["suit"] < CARD_SUIT_COUNT):
+                return False, "invalid card data in %s" % name
+    return True, ""
+
+
+def intersects(a, b, width, height):
+    """与 cocos2d::Rect::intersectsRect 一致（边界相接也算重叠），锚点为卡牌中心"""
+    half_w = width * 0.5
+    half_h = height * 0.5
+    return not (a["x"] + half_w < b["x"] - half_w or b["x"] + half_w < a["x"] - half_w or
+                a["y"] + half_h < b["y"] - half_h or b["y"] + half_h < a["y"] - half_h)
+
+
+def build_cover_graph(playfield, width, height):
+    """后摆放的卡牌覆盖与之重叠的先摆放卡牌，返回每张卡覆盖的卡牌索引列表"""
+    return [[j for j in range(i) if intersects(card, playfield[j], width, height)]
+            for i, card in enumerate(playfield)]
+
+
+def compile_level(level_id, config, width, height):
+    playfield = read_cards(config.get("Playfield"))
+    stack = read_cards(config.get("Stack"))
+    valid, reason = validate(playfield, stack)
+    cover_graph = build_cover_graph(playfield, width, height) if valid else [[] for _ in playfield]
+
+    card_table = bytearray()
+    cover_table = bytearray()
+    cover_count = 0
+    for index, card in enumerate(playfield + stack):
+        covered = cover_graph[index] if index < len(playfield) else []
+        card_table += struct.pack(CARD_FORMAT, card["face"], card["suit"], card["x"], card["y"],
+                                  0, cover_count, len(covered))
+        for covered_index in covered:
+            cover_table += struct.pack("<I", covered_index)
+        cover_count += len(covered)
+
+    card_table_offset = HEADER_SIZE
+    cover_table_offset = card_table_offset + len(card_table)
+    total_size = cover_table_offset + len(cover_table)
+    header = struct.pack(HEADER_FORMAT, MAGIC, VERSION, level_id, FLAG_VALIDATED if valid else 0,
+                         width, height, len(playfield), len(stack), cover_count,
+                         card_table_offset, cover_table_offset, total_size)
+    return header + bytes(card_table) + bytes(cover_table), valid, reason
+
+
+def build_pack(levels):
+    """levels: {level_id: 编译后的关卡数据}，索引表按 level_id - first_level_id 稠密排列"""
+    first_level_id = min(levels)
+    level_count = max(levels) - first_level_id + 1
+    index_offset = struct.calcsize(PACK_HEADER_FORMAT)
+    offset = index_offset + level_count * struct.calcsize(PACK_INDEX_FORMAT)
+
+    index = bytearray()
+    records = bytearray()
+    for level_id in range(first_level_id, first_level_id + level_count):
+        data = levels.get(level_id)
+        if data is None:
+            index += struct.pack(PACK_INDEX_FORMAT, 0, 0)
+            continue
+        index += struct.pack(PACK_INDEX_FORMAT, offset, len(data))
+        records += data
+        offset += len(data)  # 关卡记录长度都是4的倍数，无需补齐
+
+    header = struct.pack(PACK_HEADER_FORMAT, PACK_MAGIC, PACK_VERSION, first_level_id, level_count,
+                         index_offset, offset)
+    return header + bytes(index) + bytes(records)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile level JSON configs into binary .lvb files")
+    parser.add_argument("--levels-dir", default=os.path.join("configs", "levels"))
+    parser.add_argument("--output-dir", default=None, help="defaults to --levels-dir")
+    parser.add_argument("--card-width", type=float, required=True)
+    parser.add_argument("--card-height", type=float, required=True)
+    parser.add_argument("--pack", action="store_true", help="write a single %s instead of per-level files" % PACK_FILE_NAME)
+    args = parser.parse_args()
+
+    output_dir = args.output_dir or args.levels_dir
+    paths = sorted(glob.glob(os.path.join(args.levels_dir, "Level_*_config.json")))
+    if not paths:
+        print("no level configs found in %s" % args.levels_dir, file=sys.stderr)
+        return 1
+
+    failed = 0
+    compiled = {}
+    for path in paths:
+        level_id = int(LEVEL_FILE_PATTERN.search(path).group(1))
+        with open(path, "r", encoding="utf-8") as f:
+            config = json.load(f)
+
+        data, valid, reason = compile_level(level_id, config, args.card_width, args.card_height)
+        if args.pack:
+            compiled[level_id] = data
+            output_path = PACK_FILE_NAME
+        else:
+            output_path = os.path.join(output_dir, "Level_%02d.lvb" % level_id)
+            with open(output_path, "wb") as f:
+                f.write(data)
+
+        if valid:
+            print("%s -> %s (%d bytes)" % (path, output_path, len(data)))
+        else:
+            # 校验失败也写出文件，运行时据此报错而不是悄悄退回JSON
+            print("%s -> %s: validation failed: %s" % (path, output_path, reason), file=sys.stderr)
+            failed += 1
+
+    if args.pack:
+        pack_path = os.path.join(output_dir, PACK_FILE_NAME)
+        data = build_pack(compiled)
+        with open(pack_path, "wb") as f:
+            f.write(data)
+        print("%d levels -> %s (%d bytes)" % (len(compiled), pack_path, len(data)))
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
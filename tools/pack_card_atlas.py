@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+卡牌图集打包：把卡牌背景、数字和花色图片打进一张纹理，输出cocos2d-x可直接加载的plist（format 2）
+
+运行时由 CardAtlas 通过 SpriteFrameCache 加载，帧名为相对 res/ 的路径（例如 number/big_red_A.png）。
+图集缺失时游戏退回加载单独图片，因此这一步只影响绘制批次，不影响功能。
+
+依赖 Pillow。用法：
+    python3 tools/pack_card_atlas.py [--res-dir res] [--max-width 2048] [--padding 2]
+"""
+
+import argparse
+import os
+import sys
+
+try:
+    from PIL import Image
+except ImportError:
+    print("Pillow is required: pip install Pillow", file=sys.stderr)
+    sys.exit(1)
+
+ATLAS_NAME = "cards"
+SOURCES = ["card_general.png", "number", "suits"]
+
+
+def collect_images(res_dir):
+    names = []
+    for source in SOURCES:
+        path = os.path.join(res_dir, source)
+        if os.path.isdir(path):
+            for file_name in sorted(os.listdir(path)):
+                if file_name.lower().endswith(".png"):
+                    names.append(source + "/" + file_name)
+        elif os.path.isfile(path):
+            names.append(source)
+    return names
+
+
+def next_power_of_two(value):
+    result = 1
+    while result < value:
+        result *= 2
+    return result
+
+
+def pack(images, max_width, padding):
+    """按高度降序的行式装箱，返回 {name: (x, y)} 和图集尺寸"""
+    order = sorted(images, key=lambda name: (-images[name].height, name))
+    placements = {}
+    x = y = row_height = used_width = 0
+    for name in order:
+        width, height = images[name].size
+        if x > 0 and x + width > max_width:
+            y += row_height + padding
+            x = row_height = 0
+        if width > max_width:
+            raise ValueError("%s is wider than the atlas" % name)
+        placements[name] = (x, y)
+        x += width + padding
+        row_height = max(row_height, height)
+        used_width = max(used_width, x - padding)
+    return placements, next_power_of_two(used_width), next_power_of_two(y + row_height)
+
+
+def write_plist(path, texture_name, images, placements, atlas_size):
+    lines = [
+        '<?xml version="1.0" encoding="UTF-8"?>',
+        '<!DOCTYPE plist PUBLIC "-//Apple//DTD PLIST 1.0//EN" "http://www.apple.com/DTDs/PropertyList-1.0.dtd">',
+        '<plist version="1.0">',
+        '<dict>',
+        '    <key>frames</key>',
+        '    <dict>',
+    ]
+    for name in sorted(images):
+        width, height = images[name].size
+        x, y = placements[name]
+        lines += [
+            '        <key>%s</key>' % name,
+            '        <dict>',
+            '            <key>frame</key><string>{{%d,%d},{%d,%d}}</string>' % (x, y, width, height),
+            '            <key>offset</key><string>{0,0}</string>',
+            '            <key>rotated</key><false/>',
+            '            <key>sourceColorRect</key><string>{{0,0},{%d,%d}}</string>' % (width, height),
+            '            <key>sourceSize</key><string>{%d,%d}</string>' % (width, height),
+            '        </dict>',
+        ]
+    lines += [
+        '    </dict>',
+        '    <key>metadata</key>',
+        '    <dict>',
+        '        <key>format</key><integer>2</integer>',
+        '        <key>realTextureFileName</key><string>%s</string>' % texture_name,
+        '        <key>size</key><string>{%d,%d}</string>' % atlas_size,
+        '        <key>textureFileName</key><string>%s</string>' % texture_name,
+        '    </dict>',
+        '</dict>',
+        '</plist>',
+    ]
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack card art into a single sprite atlas")
+    parser.add_argument("--res-dir", default="res")
+    parser.add_argument("--max-width", type=int, default=2048)
+    parser.add_argument("--padding", type=int, default=2)
+    args = parser.parse_args()
+
+    names = collect_images(args.res_dir)
+    if not names:
+        print("no card images found in %s" % args.res_dir, file=sys.stderr)
+        return 1
+
+    images = {name: Image.open(os.path.join(args.res_dir, name)).convert("RGBA") for name in names}
+    placements, width, height = pack(images, args.max_width, args.padding)
+
+    atlas = Image.new("RGBA", (width, height), (0, 0, 0, 0))
+    for name, (x, y) in placements.items():
+        atlas.paste(images[name], (x, y))
+
+    texture_name = ATLAS_NAME + ".png"
+    atlas.save(os.path.join(args.res_dir, texture_name))
+    write_plist(os.path.join(args.res_dir, ATLAS_NAME + ".plist"), texture_name, images, placements, (width, height))
+    print("%d images -> %s/%s.{png,plist} (%dx%d)" % (len(images), args.res_dir, ATLAS_NAME, width, height))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
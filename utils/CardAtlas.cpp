@@ -0,0 +1,63 @@
+#include "CardAtlas.h"
+
+USING_NS_CC;
+
+const char* CardAtlas::ATLAS_PLIST = "res/cards.plist";
+
+namespace {
+
+const char* const RES_PREFIX = "res/";
+
+} // namespace
+
+bool CardAtlas::isLoaded() {
+    static bool loaded = false;
+    static bool attempted = false;
+    if (!attempted) {
+        attempted = true;
+        if (FileUtils::getInstance()->isFileExist(ATLAS_PLIST)) {
+            SpriteFrameCache::getInstance()->addSpriteFramesWithFile(ATLAS_PLIST);
+            loaded = SpriteFrameCache::getInstance()->isSpriteFramesWithFileLoaded(ATLAS_PLIST);
+        }
+        CCLOG("CardAtlas: %s", loaded ? "using card atlas" : "atlas not found, using separate images");
+    }
+    return loaded;
+}
+
+Sprite* CardAtlas::createSprite(const std::string& imagePath) {
+    SpriteFrame* frame = findFrame(imagePath);
+    return frame ? Sprite::createWithSpriteFrame(frame) : Sprite::create(imagePath);
+}
+
+void CardAtlas::setSpriteImage(Sprite* sprite, const std::string& imagePath) {
+    if (!sprite) {
+        return;
+    }
+
+    SpriteFrame* frame = findFrame(imagePath);
+    if (frame) {
+        sprite->setSpriteFrame(frame);
+    } else {
+        sprite->setTexture(imagePath);
+    }
+}
+
+Size CardAtlas::getImageSize(const std::string& imagePath) {
+    SpriteFrame* frame = findFrame(imagePath);
+    if (frame) {
+        return frame->getOriginalSize();
+    }
+
+    Texture2D* texture = Director::getInstance()->getTextureCache()->addImage(imagePath);
+    return texture ? texture->getContentSize() : Size::ZERO;
+}
+
+SpriteFrame* CardAtlas::findFrame(const std::string& imagePath) {
+    if (!isLoaded()) {
+        return nullptr;
+    }
+
+    size_t prefixLength = strlen(RES_PREFIX);
+    bool hasPrefix = imagePath.compare(0, prefixLength, RES_PREFIX) == 0;
+    return SpriteFrameCache::getInstance()->getSpriteFrameByName(hasPrefix ? imagePath.substr(prefixLength) : imagePath);
+}
\ No newline at end of file
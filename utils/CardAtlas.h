@@ -0,0 +1,48 @@
+#ifndef __CARD_ATLAS_H__
+#define __CARD_ATLAS_H__
+
+#include "cocos2d.h"
+#include <string>
+
+/**
+ * @class CardAtlas
+ * @brief 卡牌美术图集
+ * 
+ * 职责：
+ * - 加载由tools/pack_card_atlas.py打包的卡牌图集（背景、数字、花色共用一张纹理）
+ * - 按原图片路径查找对应的精灵帧，整个牌面只绑定一张纹理，便于自动合批
+ * - 图集缺失时退回按路径加载单独的图片，保证开发期资源未打包也能运行
+ * 
+ * 帧名为去掉"res/"前缀的相对路径，例如"number/big_red_A.png"。
+ * 只能在主线程使用。
+ */
+class CardAtlas {
+public:
+    static const char* ATLAS_PLIST;
+
+    /**
+     * @brief 图集是否可用（首次调用时加载）
+     */
+    static bool isLoaded();
+
+    /**
+     * @brief 创建显示指定图片的精灵
+     * @param imagePath 原图片路径，例如"res/card_general.png"
+     */
+    static cocos2d::Sprite* createSprite(const std::string& imagePath);
+
+    /**
+     * @brief 让精灵显示指定图片（图集中有则切换精灵帧，否则加载单独纹理）
+     */
+    static void setSpriteImage(cocos2d::Sprite* sprite, const std::string& imagePath);
+
+    /**
+     * @brief 获取图片的原始尺寸
+     */
+    static cocos2d::Size getImageSize(const std::string& imagePath);
+
+private:
+    static cocos2d::SpriteFrame* findFrame(const std::string& imagePath);
+};
+
+#endif // __CARD_ATLAS_H__
\ No newline at end of file
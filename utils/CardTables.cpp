@@ -0,0 +1,19 @@
+#include "CardTables.h"
+
+// 编译期表被按运行时下标访问（odr-use），C++14下需要类外定义
+constexpr int CardTables::FACE_COUNT;
+constexpr int CardTables::SUIT_COUNT;
+constexpr int CardTables::COLOR_BLACK;
+constexpr int CardTables::COLOR_RED;
+constexpr int CardTables::COLOR_COUNT;
+constexpr const char* CardTables::BACK_IMAGE;
+constexpr const char* CardTables::BIG_NUMBER_IMAGES[CardTables::COLOR_COUNT][CardTables::FACE_COUNT];
+constexpr const char* CardTables::SMALL_NUMBER_IMAGES[CardTables::COLOR_COUNT][CardTables::FACE_COUNT];
+constexpr const char* CardTables::SUIT_IMAGES[CardTables::SUIT_COUNT];
+constexpr int CardTables::SUIT_COLORS[CardTables::SUIT_COUNT];
+constexpr int CardTables::FACE_VALUES[CardTables::FACE_COUNT];
+
+static_assert(CardTables::FACE_COUNT == 13, "card art tables assume 13 faces");
+static_assert(CardTables::SUIT_COUNT == 4, "card art tables assume 4 suits");
+static_assert(CST_CLUBS == 0 && CST_DIAMONDS == 1 && CST_HEARTS == 2 && CST_SPADES == 3,
+              "SUIT_IMAGES and SUIT_COLORS follow CardSuitType order");
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef __CARD_TABLES_H__
+#define __CARD_TABLES_H__
+
+#include "../models/CardModel.h"
+
+/**
+ * @class CardTables
+ * @brief 卡牌编译期查找表
+ * 
+ * 职责：
+ * - 按点数、花色直接索引美术图片路径（字符串常量，不做任何拼接和分配）
+ * - 提供花色颜色、点数数值等元数据
+ * - 非法点数按A、非法花色按黑色/红桃图标处理，与原先的switch默认分支一致
+ */
+class CardTables {
+public:
+    static constexpr int FACE_COUNT = CFT_NUM_CARD_FACE_TYPES;
+    static constexpr int SUIT_COUNT = CST_NUM_CARD_SUIT_TYPES;
+    static constexpr int COLOR_BLACK = 0;
+    static constexpr int COLOR_RED = 1;
+    static constexpr int COLOR_COUNT = 2;
+
+    static constexpr const char* BACK_IMAGE = "res/card_general.png";
+
+    static constexpr const char* BIG_NUMBER_IMAGES[COLOR_COUNT][FACE_COUNT] = {
+        { "res/number/big_black_A.png", "res/number/big_black_2.png", "res/number/big_black_3.png",
+          "res/number/big_black_4.png", "res/number/big_black_5.png", "res/number/big_black_6.png",
+          "res/number/big_black_7.png", "res/number/big_black_8.png", "res/number/big_black_9.png",
+          "res/number/big_black_10.png", "res/number/big_black_J.png", "res/number/big_black_Q.png",
+          "res/number/big_black_K.png" },
+        { "res/number/big_red_A.png", "res/number/big_red_2.png", "res/number/big_red_3.png",
+          "res/number/big_red_4.png", "res/number/big_red_5.png", "res/number/big_red_6.png",
+          "res/number/big_red_7.png", "res/number/big_red_8.png", "res/number/big_red_9.png",
+          "res/number/big_red_10.png", "res/number/big_red_J.png", "res/number/big_red_Q.png",
+          "res/number/big_red_K.png" }
+    };
+
+    static constexpr const char* SMALL_NUMBER_IMAGES[COLOR_COUNT][FACE_COUNT] = {
+        { "res/number/small_black_A.png", "res/number/small_black_2.png", "res/number/small_black_3.png",
+          "res/number/small_black_4.png", "res/number/small_black_5.png", "res/number/small_black_6.png",
+          "res/number/small_black_7.png", "res/number/small_black_8.png", "res/number/small_black_9.png",
+          "res/number/small_black_10.png", "res/number/small_black_J.png", "res/number/small_black_Q.png",
+          "res/number/small_black_K.png" },
+        { "res/number/small_red_A.png", "res/number/small_red_2.png", "res/number/small_red_3.png",
+          "res/number/small_red_4.png", "res/number/small_red_5.png", "res/number/small_red_6.png",
+          "res/number/small_red_7.png", "res/number/small_red_8.png", "res/number/small_red_9.png",
+          "res/number/small_red_10.png", "res/number/small_red_J.png", "res/number/small_red_Q.png",
+          "res/number/small_red_K.png" }
+    };
+
+    // 顺序与CardSuitType一致：梅花、方块、红桃、黑桃
+    static constexpr const char* SUIT_IMAGES[SUIT_COUNT] = {
+        "res/suits/club.png", "res/suits/diamond.png", "res/suits/heart.png", "res/suits/spade.png"
+    };
+
+    static constexpr int SUIT_COLORS[SUIT_COUNT] = { COLOR_BLACK, COLOR_RED, COLOR_RED, COLOR_BLACK };
+
+    // 点数数值：A为0，K为12
+    static constexpr int FACE_VALUES[FACE_COUNT] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+    static bool isValidFace(CardFaceType face) { return face >= 0 && face < FACE_COUNT; }
+    static bool isValidSuit(CardSuitType suit) { return suit >= 0 && suit < SUIT_COUNT; }
+
+    static int colorOf(CardSuitType suit) { return isValidSuit(suit) ? SUIT_COLORS[suit] : COLOR_BLACK; }
+    static bool isRedSuit(CardSuitType suit) { return colorOf(suit) == COLOR_RED; }
+    static int faceValueOf(CardFaceType face) { return isValidFace(face) ? FACE_VALUES[face] : static_cast<int>(face); }
+
+    static const char* bigNumberImage(CardFaceType face, CardSuitType suit) {
+        return BIG_NUMBER_IMAGES[colorOf(suit)][isValidFace(face) ? face : CFT_ACE];
+    }
+    static const char* smallNumberImage(CardFaceType face, CardSuitType suit) {
+        return SMALL_NUMBER_IMAGES[colorOf(suit)][isValidFace(face) ? face : CFT_ACE];
+    }
+    static const char* suitImage(CardSuitType suit) {
+        return SUIT_IMAGES[isValidSuit(suit) ? suit : CST_HEARTS];
+    }
+};
+
+#endif // __CARD_TABLES_H__
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "GameClock.h"
+#include "cocos2d.h"
+
+namespace {
+
+struct ClockState {
+    GameClock::Speed speed = GameClock::Speed::NORMAL;
+    double accumulator = 0.0;   ///< 尚未推进的模拟时间
+    long long steps = 0;        ///< 已推进的固定步数，模拟时间由它换算，避免浮点累加误差
+};
+
+ClockState& getState() {
+    static ClockState state;
+    return state;
+}
+
+} // namespace
+
+void GameClock::setSpeed(Speed speed) {
+    ClockState& state = getState();
+    if (state.speed == speed) {
+        return;
+    }
+
+    // 换档时丢弃不足一步的余量，新档位从整步开始
+    state.speed = speed;
+    state.accumulator = 0.0;
+    CCLOG("GameClock: speed set to %.0fx%s", getTimeScale(), speed == Speed::INSTANT ? " (instant)" : "");
+}
+
+GameClock::Speed GameClock::getSpeed() {
+    return getState().speed;
+}
+
+float GameClock::getTimeScale() {
+    switch (getState().speed) {
+        case Speed::NORMAL:  return 1.0f;
+        case Speed::FAST:    return 4.0f;
+        case Speed::TURBO:   return 32.0f;
+        case Speed::INSTANT: return 0.0f;
+    }
+    return 1.0f;
+}
+
+int GameClock::beginFrame(float dt) {
+    ClockState& state = getState();
+    if (state.speed == Speed::INSTANT) {
+        state.accumulator = 0.0;
+        return MAX_STEPS_PER_FRAME;
+    }
+
+    state.accumulator += (double)dt * getTimeScale();
+    int steps = (int)(state.accumulator / FIXED_STEP);
+    if (steps > MAX_STEPS_PER_FRAME) {
+        // 长时间卡顿后不追赶，丢弃超出的部分
+        steps = MAX_STEPS_PER_FRAME;
+        state.accumulator = 0.0;
+    } else {
+        state.accumulator -= steps * (double)FIXED_STEP;
+    }
+    return steps;
+}
+
+void GameClock::step() {
+    getState().steps++;
+}
+
+double GameClock::getTime() {
+    return getState().steps * (double)FIXED_STEP;
+}
+
+bool GameClock::hasElapsed(double since, float duration) {
+    return isInstant() || getTime() - since >= duration;
+}
@@ -0,0 +1,61 @@
+#ifndef __GAME_CLOCK_H__
+#define __GAME_CLOCK_H__
+
+/**
+ * @class GameClock
+ * @brief 固定步长的游戏时钟
+ *
+ * 职责：
+ * - 把每帧的真实时间按倍速累积，换算成本帧要推进的固定步数
+ * - 提供模拟时间，动画时长（GameUtils::ANIMATION_DURATION等）和回退冷却都以模拟时间计
+ * - 支持 1×/4×/32×/瞬时 四档速度，用于快速回放和脚本化测试（调试版本中由界面上的Speed按钮循环切换）
+ *
+ * 补间每步都按FIXED_STEP推进，完成回调落在同一个模拟步上，任何倍速下结果一致；
+ * 倍速只改变每帧执行的步数。瞬时档每帧最多执行MAX_STEPS_PER_FRAME步，
+ * 由调用方在没有进行中的动画时提前结束，等待类的计时（如回退冷却）视为已到期。
+ */
+class GameClock {
+public:
+    enum class Speed {
+        NORMAL,   // 1×
+        FAST,     // 4×
+        TURBO,    // 32×
+        INSTANT   // 动画在当帧完成
+    };
+
+    static constexpr float FIXED_STEP = 1.0f / 60.0f;
+    static constexpr int MAX_STEPS_PER_FRAME = 4096;
+
+    static void setSpeed(Speed speed);
+    static Speed getSpeed();
+    static bool isInstant() { return getSpeed() == Speed::INSTANT; }
+
+    /**
+     * @brief 当前倍速（瞬时档返回0）
+     */
+    static float getTimeScale();
+
+    /**
+     * @brief 开始新的一帧
+     * @param dt 本帧真实时间（秒）
+     * @return 本帧应推进的固定步数
+     */
+    static int beginFrame(float dt);
+
+    /**
+     * @brief 推进一个固定步，模拟时间增加FIXED_STEP
+     */
+    static void step();
+
+    /**
+     * @brief 当前模拟时间（秒）
+     */
+    static double getTime();
+
+    /**
+     * @brief 从since起是否已经过duration秒模拟时间（瞬时档总是返回true）
+     */
+    static bool hasElapsed(double since, float duration);
+};
+
+#endif // __GAME_CLOCK_H__
@@ -10,9 +10,9 @@
  * 
  * 职责：
  * - 提供统一的层级计算逻辑
- * - 提供统一的动画创建方法
- * - 提供统一的位置计算逻辑
+ * - 提供统一的动画参数（时长、缩放）
  * - 提供通用的常量定义
+ * - 提供统一的界面文字标签创建
  */
 class GameUtils {
 public:
@@ -21,8 +21,8 @@ public:
     static constexpr int STACK_ZORDER_BASE = 1000;
     static constexpr int BOTTOM_PILE_ZORDER_BASE = 3000; // 底牌堆层级基础值
     static constexpr int MOVING_CARD_ZORDER = 5000; // 移动中卡牌的层级（最高）
+    // 动画时长按GameClock模拟时间计，实际时长随游戏倍速缩放
     static constexpr float ANIMATION_DURATION = 0.5f;
-    static constexpr float SCALE_ANIMATION_DURATION = 0.25f;
     static constexpr float PLAYFIELD_Y_OFFSET = 500.0f;
     static constexpr float STACK_BASE_X = 200.0f;
     static constexpr float STACK_BASE_Y = 300.0f;
@@ -39,34 +39,6 @@ public:
      */
     static int calculateCorrectZOrder(int cardId, const GameModel* gameModel);
     
-    /**
-     * @brief 计算卡牌的目标位置
-     * @param cardModel 卡牌模型
-     * @param cardId 卡牌ID
-     * @return 计算后的目标位置
-     */
-    static cocos2d::Vec2 calculateTargetPosition(const CardModel* cardModel, int cardId);
-    
-    /**
-     * @brief 创建回退动画序列（简化版本，不包含回调）
-     * @param targetPosition 目标位置
-     * @return 动画序列
-     */
-    static cocos2d::Sequence* createUndoAnimationSequence(const cocos2d::Vec2& targetPosition);
-    
-    /**
-     * @brief 创建移动到顶部的动画序列（简化版本，不包含回调）
-     * @param targetPosition 目标位置
-     * @return 动画序列
-     */
-    static cocos2d::Sequence* createMoveToTopAnimationSequence(const cocos2d::Vec2& targetPosition);
-    
-    /**
-     * @brief 创建匹配动画序列
-     * @return 动画序列
-     */
-    static cocos2d::Sequence* createMatchAnimationSequence();
-    
     /**
      * @brief 获取卡牌在JSON中的顺序
      * @param cardId 卡牌ID
@@ -84,16 +56,21 @@ public:
     static bool isCardInBottomPile(int cardId, const GameModel* gameModel);
     
     /**
-     * @brief 应用位置调整逻辑
-     * @param position 原始位置
-     * @param cardModel 卡牌模型
+     * @brief 计算视图同步时卡牌的层级：底牌堆查层级表，主牌堆按JSON顺序，其余为备用牌堆层级
      * @param cardId 卡牌ID
-     * @return 调整后的位置
+     * @param gameModel 游戏模型
+     * @return zOrder值
+     */
+    static int calculateSyncZOrder(int cardId, const GameModel* gameModel);
+    
+    /**
+     * @brief 创建界面文字标签
+     * 优先使用预生成的位图字体图集（fonts/ui.fnt），缺少时退回TTF字体
+     * @param text 文字
+     * @param fontSize 字号
+     * @return 标签
      */
-    static cocos2d::Vec2 applyPositionAdjustment(
-        const cocos2d::Vec2& position, 
-        const CardModel* cardModel, 
-        int cardId);
+    static cocos2d::Label* createUILabel(const std::string& text, float fontSize);
 };
 
 #endif // __GAME_UTILS_H__
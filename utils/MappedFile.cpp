@@ -0,0 +1,84 @@
+#include "MappedFile.h"
+
+#if (CC_TARGET_PLATFORM != CC_PLATFORM_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+MappedFile::MappedFile()
+    : _data(nullptr)
+    , _size(0)
+    , _mapped(false) {
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    std::string fullPath = FileUtils::getInstance()->fullPathForFilename(filename);
+    if (fullPath.empty()) {
+        return false;
+    }
+
+    if (mapFile(fullPath)) {
+        return true;
+    }
+
+    // 退化为整体读取（例如Android的APK内资源无法直接映射）
+    _fallbackData = FileUtils::getInstance()->getDataFromFile(fullPath);
+    if (_fallbackData.isNull()) {
+        return false;
+    }
+
+    _data = _fallbackData.getBytes();
+    _size = (size_t)_fallbackData.getSize();
+    return true;
+}
+
+void MappedFile::close() {
+#if (CC_TARGET_PLATFORM != CC_PLATFORM_WIN32)
+    if (_mapped && _data) {
+        munmap(const_cast<unsigned char*>(_data), _size);
+    }
+#endif
+    _fallbackData.clear();
+    _data = nullptr;
+    _size = 0;
+    _mapped = false;
+}
+
+bool MappedFile::mapFile(const std::string& fullPath) {
+#if (CC_TARGET_PLATFORM != CC_PLATFORM_WIN32)
+    int fd = ::open(fullPath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* address = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // 映射建立后即可关闭文件描述符
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        return false;
+    }
+
+    _data = static_cast<const unsigned char*>(address);
+    _size = (size_t)fileStat.st_size;
+    _mapped = true;
+    return true;
+#else
+    return false;
+#endif
+}
\ No newline at end of file
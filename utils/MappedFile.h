@@ -0,0 +1,49 @@
+#ifndef __MAPPED_FILE_H__
+#define __MAPPED_FILE_H__
+
+#include "cocos2d.h"
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief 只读文件映射
+ * 
+ * 职责：
+ * - 优先使用mmap把文件映射到内存，供调用方原地读取
+ * - 无法映射时（Android APK内资源、Win32）退化为一次性读入内存
+ * - 不涉及业务逻辑，完全独立
+ */
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    /**
+     * @brief 打开并映射文件
+     * @param filename 文件名（按FileUtils的搜索路径解析）
+     * @return 是否打开成功
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * @brief 解除映射
+     */
+    void close();
+
+    bool isOpen() const { return _data != nullptr; }
+    const unsigned char* getData() const { return _data; }
+    size_t getSize() const { return _size; }
+
+private:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool mapFile(const std::string& fullPath);
+
+    const unsigned char* _data;
+    size_t _size;
+    bool _mapped;                   ///< true表示_data来自mmap，需要munmap
+    cocos2d::Data _fallbackData;    ///< 无法映射时的内存副本
+};
+
+#endif // __MAPPED_FILE_H__
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "BoardLayout.h"
+#include "../models/GameModel.h"
+#include "../utils/GameUtils.h"
+#include <algorithm>
+#include <climits>
+
+USING_NS_CC;
+
+BoardLayout::BoardLayout()
+    : _firstCardId(0) {
+}
+
+void BoardLayout::build(const GameModel& model) {
+    const auto& allCards = model.getAllCards();
+    _slots.clear();
+    if (allCards.empty()) {
+        _firstCardId = 0;
+        return;
+    }
+    
+    int minCardId = INT_MAX;
+    int maxCardId = INT_MIN;
+    for (const auto& pair : allCards) {
+        minCardId = std::min(minCardId, pair.first);
+        maxCardId = std::max(maxCardId, pair.first);
+    }
+    _firstCardId = minCardId;
+    _slots.resize(maxCardId - minCardId + 1);
+    
+    std::vector<char> inPlayfield(_slots.size(), 0);
+    for (int cardId : model.getPlayfieldCardIds()) {
+        inPlayfield[cardId - minCardId] = 1;
+    }
+    
+    // 按卡牌ID顺序（即关卡配置顺序）遍历，未配置位置的非主牌堆卡牌依次占用备用牌堆槽位
+    int stackIndex = 0;
+    for (int cardId = minCardId; cardId <= maxCardId; ++cardId) {
+        auto it = allCards.find(cardId);
+        if (it == allCards.end()) {
+            continue;
+        }
+        
+        const Vec2& position = it->second.getPosition();
+        Slots& slots = _slots[cardId - minCardId];
+        slots.playfield = Vec2(position.x, position.y + GameUtils::PLAYFIELD_Y_OFFSET);
+        
+        if (position == Vec2::ZERO && !inPlayfield[cardId - minCardId]) {
+            slots.stack = Vec2(GameUtils::STACK_BASE_X + stackIndex * GameUtils::STACK_CARD_SPACING,
+                               GameUtils::STACK_BASE_Y);
+            stackIndex++;
+        } else {
+            slots.stack = position;
+        }
+    }
+    
+    CCLOG("BoardLayout built for %d cards (%d stack slots)", (int)allCards.size(), stackIndex);
+}
+
+Vec2 BoardLayout::getPosition(int cardId, const GameModel& model) const {
+    if (model.getBottomPileOrder(cardId) >= 0) {
+        return getBottomSlot();
+    }
+    
+    const CardModel* cardModel = model.getCard(cardId);
+    if (cardModel && cardModel->isInPlayfield()) {
+        return getPlayfieldSlot(cardId);
+    }
+    return getStackSlot(cardId);
+}
+
+Vec2 BoardLayout::getPlayfieldSlot(int cardId) const {
+    const Slots* slots = findSlots(cardId);
+    return slots ? slots->playfield : Vec2::ZERO;
+}
+
+Vec2 BoardLayout::getStackSlot(int cardId) const {
+    const Slots* slots = findSlots(cardId);
+    return slots ? slots->stack : Vec2::ZERO;
+}
+
+Vec2 BoardLayout::getBottomSlot() {
+    return Vec2(GameUtils::TOP_CARD_X, GameUtils::TOP_CARD_Y);
+}
+
+const BoardLayout::Slots* BoardLayout::findSlots(int cardId) const {
+    int index = cardId - _firstCardId;
+    if (index < 0 || index >= (int)_slots.size()) {
+        CCLOGERROR("BoardLayout: no slot for card %d", cardId);
+        return nullptr;
+    }
+    return &_slots[index];
+}
@@ -0,0 +1,54 @@
+#ifndef __BOARD_LAYOUT_H__
+#define __BOARD_LAYOUT_H__
+
+#include "cocos2d.h"
+#include <vector>
+
+class GameModel;
+
+/**
+ * @class BoardLayout
+ * @brief 每关预计算的卡牌屏幕位置表
+ * 
+ * 职责：
+ * - 关卡载入时为每张卡牌一次性算出主牌堆槽位和备用牌堆槽位，存入按卡牌ID索引的连续数组
+ * - 备用牌堆按卡牌在关卡中的顺序从左到右展开，与主牌堆卡牌数量无关
+ * - 视图创建、同步、动画和回退只按卡牌当前所在牌堆查表，不再各自重复计算
+ * 
+ * 卡牌位置（关卡配置）变化后需重新build。
+ */
+class BoardLayout {
+public:
+    BoardLayout();
+
+    /**
+     * @brief 根据模型中全部卡牌计算位置表
+     */
+    void build(const GameModel& model);
+
+    /**
+     * @brief 卡牌按当前所在牌堆应处的位置（底牌堆、主牌堆或备用牌堆槽位）
+     */
+    cocos2d::Vec2 getPosition(int cardId, const GameModel& model) const;
+
+    cocos2d::Vec2 getPlayfieldSlot(int cardId) const;
+    cocos2d::Vec2 getStackSlot(int cardId) const;
+
+    /**
+     * @brief 底牌堆（顶部牌）位置，所有底牌堆卡牌叠放于此
+     */
+    static cocos2d::Vec2 getBottomSlot();
+
+private:
+    struct Slots {
+        cocos2d::Vec2 playfield;
+        cocos2d::Vec2 stack;
+    };
+
+    const Slots* findSlots(int cardId) const;
+
+    int _firstCardId;
+    std::vector<Slots> _slots;  // 下标为 cardId - _firstCardId
+};
+
+#endif // __BOARD_LAYOUT_H__
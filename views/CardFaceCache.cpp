@@ -0,0 +1,229 @@
+#include "CardFaceCache.h"
+#include "../utils/CardAtlas.h"
+#include "../utils/CardTables.h"
+
+USING_NS_CC;
+
+namespace {
+
+const int FACE_COUNT = CFT_NUM_CARD_FACE_TYPES;
+const int SUIT_COUNT = CST_NUM_CARD_SUIT_TYPES;
+const int CELL_COUNT = FACE_COUNT * SUIT_COUNT + 1;    ///< 52张正面加牌背
+const int ATLAS_COLUMNS = 8;
+
+/**
+ * 图集中的一格：位置固定，首次被引用时绘制进画布，画布存活期间保持有效
+ */
+struct FaceCell {
+    int refCount = 0;
+    RefPtr<SpriteFrame> frame;                     ///< 未绘制的格为空
+};
+
+/**
+ * 已提交、尚未被绘制的合成：拼装节点和目标画布要存活到本帧绘制结束
+ */
+struct PendingComposition {
+    RefPtr<Node> source;
+    RefPtr<RenderTexture> target;
+};
+
+struct FaceCacheState {
+    bool attempted = false;
+    bool ready = false;
+    Size cardSize;
+    RefPtr<RenderTexture> canvas;                  ///< 所有牌面共用的图集画布，有存活牌面时才存在
+    FaceCell cells[CELL_COUNT];
+    int liveCount = 0;
+    std::vector<PendingComposition> pending;
+};
+
+FaceCacheState& getState() {
+    static FaceCacheState state;
+    return state;
+}
+
+void addPart(Node* parent, const char* imagePath, const Vec2& position) {
+    Sprite* sprite = CardAtlas::createSprite(imagePath);
+    if (sprite) {
+        sprite->setAnchorPoint(Vec2::ANCHOR_MIDDLE);
+        sprite->setPosition(position);
+        parent->addChild(sprite);
+    }
+}
+
+/**
+ * 创建空白画布，清屏命令随本帧场景一起绘制
+ */
+bool createCanvas(FaceCacheState& state) {
+    int rows = (CELL_COUNT + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS;
+    RenderTexture* canvas = RenderTexture::create((int)(state.cardSize.width * ATLAS_COLUMNS),
+                                                  (int)(state.cardSize.height * rows),
+                                                  Texture2D::PixelFormat::RGBA8888);
+    if (!canvas) {
+        CCLOGERROR("CardFaceCache: failed to create face canvas");
+        return false;
+    }
+
+    canvas->beginWithClear(0, 0, 0, 0);
+    canvas->end();
+    state.pending.push_back({ nullptr, canvas });
+    state.canvas = canvas;
+    return true;
+}
+
+/**
+ * 把一张牌面的绘制命令提交给渲染器，画到它在图集中的固定格里，随本帧场景一起绘制，不单独刷新渲染队列。
+ * 画布纹理的行序与渲染坐标相反（第0行在底部），因此各格上下翻转绘制：
+ * 精灵帧按左上角原点取矩形 (column, row) 时，得到的正是正向的牌面。
+ */
+void composeCell(FaceCacheState& state, int key, FaceCell& cell) {
+    Node* source = (key == CardFaceCache::BACK_KEY)
+        ? CardFaceCache::createComposedBack()
+        : CardFaceCache::createComposedFace(static_cast<CardFaceType>(key % FACE_COUNT),
+                                            static_cast<CardSuitType>(key / FACE_COUNT));
+    int column = key % ATLAS_COLUMNS;
+    int row = key / ATLAS_COLUMNS;
+    source->setScaleY(-1.0f);
+    source->setPosition(Vec2(column * state.cardSize.width, (row + 1) * state.cardSize.height));
+
+    // 不清屏，保留已合成的格
+    state.canvas->begin();
+    source->visit();
+    state.canvas->end();
+    state.pending.push_back({ source, state.canvas });
+
+    Rect rect(column * state.cardSize.width, row * state.cardSize.height, state.cardSize.width, state.cardSize.height);
+    cell.frame = SpriteFrame::createWithTexture(state.canvas->getSprite()->getTexture(), rect);
+}
+
+/**
+ * 最后一张牌面释放后丢弃画布，已绘制的格随之失效
+ */
+void releaseCanvas(FaceCacheState& state) {
+    for (FaceCell& cell : state.cells) {
+        cell.frame.reset();
+    }
+    // 仍在绘制队列中的合成由pending持有，本帧结束后一并释放
+    state.canvas.reset();
+}
+
+} // namespace
+
+const int CardFaceCache::BACK_KEY = FACE_COUNT * SUIT_COUNT;
+
+bool CardFaceCache::build() {
+    FaceCacheState& state = getState();
+    if (state.attempted) {
+        return state.ready;
+    }
+    state.attempted = true;
+
+    state.cardSize = getCardSize();
+    if (state.cardSize.width <= 0 || state.cardSize.height <= 0) {
+        CCLOGERROR("CardFaceCache: card background not available");
+        return false;
+    }
+
+    // 本帧绘制完成后，已提交的合成不再需要拼装节点
+    Director::getInstance()->getEventDispatcher()->addCustomEventListener(Director::EVENT_AFTER_DRAW,
+        [](EventCustom*) {
+            getState().pending.clear();
+        });
+
+    state.ready = true;
+    return true;
+}
+
+int CardFaceCache::getFaceKey(CardFaceType face, CardSuitType suit) {
+    if (face < 0 || face >= FACE_COUNT || suit < 0 || suit >= SUIT_COUNT) {
+        return -1;
+    }
+    return (int)suit * FACE_COUNT + (int)face;
+}
+
+SpriteFrame* CardFaceCache::acquireFrame(int key) {
+    if (key < 0 || key >= CELL_COUNT || !build()) {
+        return nullptr;
+    }
+
+    FaceCacheState& state = getState();
+    if (!state.canvas && !createCanvas(state)) {
+        return nullptr;
+    }
+
+    FaceCell& cell = state.cells[key];
+    if (!cell.frame) {
+        composeCell(state, key, cell);
+    }
+    if (cell.refCount++ == 0) {
+        state.liveCount++;
+    }
+    return cell.frame.get();
+}
+
+void CardFaceCache::releaseFrame(int key) {
+    if (key < 0 || key >= CELL_COUNT) {
+        return;
+    }
+
+    FaceCacheState& state = getState();
+    FaceCell& cell = state.cells[key];
+    if (cell.refCount <= 0 || --cell.refCount > 0) {
+        return;
+    }
+
+    // 格内容留在画布上，再次引用时直接复用；没有存活牌面时整张画布释放
+    if (--state.liveCount == 0) {
+        releaseCanvas(state);
+    }
+}
+
+int CardFaceCache::getLiveFrameCount() {
+    return getState().liveCount;
+}
+
+Size CardFaceCache::getCardSize() {
+    return CardAtlas::getImageSize(getBackImagePath());
+}
+
+Node* CardFaceCache::createComposedFace(CardFaceType face, CardSuitType suit) {
+    Node* node = createComposedBack();
+    Size cardSize = node->getContentSize();
+
+    // 大数字居中，小数字在右上角，花色在左上角（距离边缘15%）
+    addPart(node, getBigNumberImagePath(face, suit), Vec2(cardSize.width * 0.5f, cardSize.height * 0.5f));
+    addPart(node, getSmallNumberImagePath(face, suit), Vec2(cardSize.width * 0.85f, cardSize.height * 0.85f));
+    addPart(node, getSuitImagePath(suit), Vec2(cardSize.width * 0.15f, cardSize.height * 0.85f));
+    return node;
+}
+
+Node* CardFaceCache::createComposedBack() {
+    Node* node = Node::create();
+    Size cardSize = getCardSize();
+    node->setContentSize(cardSize);
+    addPart(node, getBackImagePath(), Vec2(cardSize.width * 0.5f, cardSize.height * 0.5f));
+    return node;
+}
+
+void CardFaceCache::collectImagePaths(CardFaceType face, CardSuitType suit, std::vector<std::string>& paths) {
+    paths.push_back(getBackImagePath());
+    paths.push_back(getBigNumberImagePath(face, suit));
+    paths.push_back(getSmallNumberImagePath(face, suit));
+    paths.push_back(getSuitImagePath(suit));
+}
+
+const char* CardFaceCache::getBackImagePath() {
+    return CardTables::BACK_IMAGE;
+}
+
+const char* CardFaceCache::getBigNumberImagePath(CardFaceType face, CardSuitType suit) {
+    return CardTables::bigNumberImage(face, suit);
+}
+
+const char* CardFaceCache::getSmallNumberImagePath(CardFaceType face, CardSuitType suit) {
+    return CardTables::smallNumberImage(face, suit);
+}
+
+const char* CardFaceCache::getSuitImagePath(CardSuitType suit) {
+    return CardTables::suitImage(suit);
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef __CARD_FACE_CACHE_H__
+#define __CARD_FACE_CACHE_H__
+
+#include "cocos2d.h"
+#include "../models/CardModel.h"
+#include <string>
+#include <vector>
+
+/**
+ * @class CardFaceCache
+ * @brief 按需合成的卡牌牌面图集
+ * 
+ * 职责：
+ * - 所有牌面共用一张图集画布，整个棋盘仍是同一纹理，可合批为一次绘制
+ * - 画布在首次引用牌面时创建；每张牌面在首次被卡牌视图引用（即首次翻开）时才绘制进自己的固定格，
+ *   一直盖着的卡牌不产生牌面
+ * - 合成命令随当帧场景一起绘制，不在输入处理中单独刷新渲染队列
+ * - 按格引用计数：卡牌离开棋盘释放引用，存活牌面数归零时释放整张画布
+ * - 卡牌视图只需一个四边形，翻面时切换精灵帧，不再为每张卡挂四个子精灵
+ * - 提供牌面拼装方法，作为合成源，也作为合成不可用时的退路
+ * 
+ * 只能在主线程、OpenGL上下文就绪后使用。
+ */
+class CardFaceCache {
+public:
+    static const int BACK_KEY;   ///< 牌背的牌面键，正面的键为 花色 * 13 + 点数
+
+    /**
+     * @brief 检查合成条件（首次acquireFrame时也会自动触发）
+     * @return 是否可以合成
+     */
+    static bool build();
+
+    /**
+     * @brief 牌面键，参数非法时返回-1
+     */
+    static int getFaceKey(CardFaceType face, CardSuitType suit);
+
+    /**
+     * @brief 引用一张牌面，首次引用时提交合成；不可用时返回nullptr（不增加引用）
+     */
+    static cocos2d::SpriteFrame* acquireFrame(int key);
+
+    /**
+     * @brief 释放acquireFrame取得的引用，最后一张存活牌面释放时释放画布
+     */
+    static void releaseFrame(int key);
+
+    /**
+     * @brief 当前存活的牌面数（含牌背）
+     */
+    static int getLiveFrameCount();
+
+    /**
+     * @brief 卡牌尺寸（取自卡牌背景图）
+     */
+    static cocos2d::Size getCardSize();
+
+    /**
+     * @brief 用背景、数字、花色精灵拼装一张正面（左下角为原点）
+     */
+    static cocos2d::Node* createComposedFace(CardFaceType face, CardSuitType suit);
+
+    /**
+     * @brief 拼装牌背（左下角为原点）
+     */
+    static cocos2d::Node* createComposedBack();
+
+    /**
+     * @brief 收集拼装一张卡牌所需的全部图片路径（用于预加载）
+     */
+    static void collectImagePaths(CardFaceType face, CardSuitType suit, std::vector<std::string>& paths);
+
+    // 图片路径来自CardTables的编译期表，返回的指针长期有效
+    static const char* getBackImagePath();
+    static const char* getBigNumberImagePath(CardFaceType face, CardSuitType suit);
+    static const char* getSmallNumberImagePath(CardFaceType face, CardSuitType suit);
+    static const char* getSuitImagePath(CardSuitType suit);
+};
+
+#endif // __CARD_FACE_CACHE_H__
\ No newline at end of file
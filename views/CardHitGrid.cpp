@@ -0,0 +1,55 @@
+#include "CardHitGrid.h"
+#include <algorithm>
+#include <cmath>
+
+USING_NS_CC;
+
+CardHitGrid::CardHitGrid()
+    : _cellSize(1.0f) {
+}
+
+void CardHitGrid::reset(float cellSize) {
+    _cellSize = cellSize > 1.0f ? cellSize : 1.0f;
+    
+    // 只清空格子内容，保留容器容量供下次重建复用
+    for (auto& cell : _cells) {
+        cell.second.clear();
+    }
+}
+
+void CardHitGrid::insert(int cardId, int zOrder, const Rect& rect) {
+    int minX = toCell(rect.getMinX());
+    int maxX = toCell(rect.getMaxX());
+    int minY = toCell(rect.getMinY());
+    int maxY = toCell(rect.getMaxY());
+    
+    for (int cellY = minY; cellY <= maxY; ++cellY) {
+        for (int cellX = minX; cellX <= maxX; ++cellX) {
+            _cells[cellKey(cellX, cellY)].push_back({cardId, zOrder});
+        }
+    }
+}
+
+void CardHitGrid::finalize() {
+    for (auto& cell : _cells) {
+        // 稳定排序：同层级时保持登记顺序
+        std::stable_sort(cell.second.begin(), cell.second.end(),
+                         [](const Entry& a, const Entry& b) { return a.zOrder > b.zOrder; });
+    }
+}
+
+const std::vector<CardHitGrid::Entry>* CardHitGrid::query(const Vec2& point) const {
+    auto it = _cells.find(cellKey(toCell(point.x), toCell(point.y)));
+    if (it == _cells.end() || it->second.empty()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+int CardHitGrid::toCell(float value) const {
+    return (int)std::floor(value / _cellSize);
+}
+
+int64_t CardHitGrid::cellKey(int cellX, int cellY) {
+    return ((int64_t)cellX << 32) ^ (int64_t)(uint32_t)cellY;
+}
@@ -0,0 +1,53 @@
+#ifndef __CARD_HIT_GRID_H__
+#define __CARD_HIT_GRID_H__
+
+#include "cocos2d.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class CardHitGrid
+ * @brief 卡牌点击检测用的空间哈希
+ * 
+ * 职责：
+ * - 按固定格子大小（通常取卡牌尺寸）把卡牌包围盒登记到所覆盖的格子中
+ * - 每个格子内的卡牌按zOrder从高到低排列，命中测试只需检查触点所在格子
+ * - 重建时复用格子内的容器，稳定后不再分配内存
+ * 
+ * 格子中只保存卡牌ID和层级，调用方需用卡牌当前包围盒确认命中，并在卡牌位置变化后重建。
+ */
+class CardHitGrid {
+public:
+    struct Entry {
+        int cardId;
+        int zOrder;
+    };
+
+    CardHitGrid();
+
+    /**
+     * @brief 清空全部格子并设置格子大小，之后用insert逐张登记，最后调用finalize
+     */
+    void reset(float cellSize);
+    void insert(int cardId, int zOrder, const cocos2d::Rect& rect);
+
+    /**
+     * @brief 把每个格子内的卡牌按zOrder从高到低排序
+     */
+    void finalize();
+
+    /**
+     * @brief 获取触点所在格子的候选卡牌（已按zOrder从高到低排序），格子为空时返回nullptr
+     */
+    const std::vector<Entry>* query(const cocos2d::Vec2& point) const;
+
+private:
+    int toCell(float value) const;
+    static int64_t cellKey(int cellX, int cellY);
+
+    float _cellSize;
+    std::unordered_map<int64_t, std::vector<Entry>> _cells;
+};
+
+#endif // __CARD_HIT_GRID_H__
@@ -0,0 +1,182 @@
+#include "CardTweener.h"
+#include "CardView.h"
+#include <algorithm>
+#include <cmath>
+
+USING_NS_CC;
+
+namespace {
+
+// 与EaseInOut::create(action, 2.0f)一致
+const float EASE_RATE = 2.0f;
+
+} // namespace
+
+CardTweener::CardTweener() {
+    _tweens.reserve(16);
+}
+
+void CardTweener::setCompletionHandler(Kind kind, const CompletionHandler& handler) {
+    _handlers[(int)kind] = handler;
+}
+
+void CardTweener::moveTo(CardView* view, Kind kind, const Vec2& target, float duration,
+                         ScaleCurve scaleCurve, float scale) {
+    if (!view) {
+        return;
+    }
+    
+    Tween tween;
+    tween.view = view;
+    tween.cardId = view->getCardId();
+    tween.kind = kind;
+    tween.elapsed = 0.0f;
+    tween.duration = duration;
+    tween.moves = true;
+    tween.from = view->getPosition();
+    tween.to = target;
+    tween.scaleCurve = scaleCurve;
+    tween.scaleFrom = view->getScale();
+    tween.scaleTo = scale;
+    start(tween);
+}
+
+void CardTweener::scaleTo(CardView* view, Kind kind, ScaleCurve scaleCurve, float scale, float duration) {
+    if (!view) {
+        return;
+    }
+    
+    Tween tween;
+    tween.view = view;
+    tween.cardId = view->getCardId();
+    tween.kind = kind;
+    tween.elapsed = 0.0f;
+    tween.duration = duration;
+    tween.moves = false;
+    tween.scaleCurve = scaleCurve;
+    tween.scaleFrom = view->getScale();
+    tween.scaleTo = scale;
+    start(tween);
+}
+
+bool CardTweener::isTweening(int cardId) const {
+    for (const Tween& tween : _tweens) {
+        if (tween.cardId == cardId) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CardTweener::hasTweens(Kind kind) const {
+    for (const Tween& tween : _tweens) {
+        if (tween.kind == kind) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CardTweener::cancelAll() {
+    _tweens.clear();
+    for (auto& completed : _completed) {
+        completed.clear();
+    }
+}
+
+void CardTweener::update(float dt) {
+    if (_tweens.empty()) {
+        return;
+    }
+    
+    // 推进全部补间，完成的与末尾交换后移除
+    size_t i = 0;
+    while (i < _tweens.size()) {
+        Tween& tween = _tweens[i];
+        tween.elapsed += dt;
+        float progress = tween.duration > 0.0f ? std::min(tween.elapsed / tween.duration, 1.0f) : 1.0f;
+        apply(tween, progress);
+        
+        if (progress < 1.0f) {
+            ++i;
+            continue;
+        }
+        
+        _completed[(int)tween.kind].push_back(tween.cardId);
+        _tweens[i] = _tweens.back();
+        _tweens.pop_back();
+    }
+    
+    // 分批回调：先把完成列表换出，回调中可以启动新补间甚至cancelAll
+    for (int kind = 0; kind < (int)Kind::COUNT; ++kind) {
+        if (_completed[kind].empty()) {
+            continue;
+        }
+        _dispatching.swap(_completed[kind]);
+        if (_handlers[kind]) {
+            _handlers[kind](_dispatching);
+        }
+        _dispatching.clear();
+    }
+}
+
+CardTweener::Tween* CardTweener::findTween(int cardId) {
+    for (Tween& tween : _tweens) {
+        if (tween.cardId == cardId) {
+            return &tween;
+        }
+    }
+    return nullptr;
+}
+
+void CardTweener::start(const Tween& tween) {
+    Tween* existing = findTween(tween.cardId);
+    if (!existing) {
+        _tweens.push_back(tween);
+        return;
+    }
+    
+    // 触摸反馈不打断动画，其余情况新补间替换旧补间
+    if (tween.kind == Kind::TOUCH_FEEDBACK && existing->kind != Kind::TOUCH_FEEDBACK) {
+        return;
+    }
+    
+    // 被替换的补间视为完成，在下一次update中随同类补间一起回调，
+    // 否则等待它的一方（例如回退完成检查）永远等不到结果
+    if (existing->kind != tween.kind) {
+        _completed[(int)existing->kind].push_back(existing->cardId);
+    }
+    *existing = tween;
+}
+
+void CardTweener::apply(const Tween& tween, float progress) {
+    if (tween.moves) {
+        float eased = easeInOut(progress);
+        tween.view->setPosition(tween.from + (tween.to - tween.from) * eased);
+    }
+    
+    switch (tween.scaleCurve) {
+        case ScaleCurve::TO:
+            tween.view->setScale(tween.scaleFrom + (tween.scaleTo - tween.scaleFrom) * progress);
+            break;
+        case ScaleCurve::PULSE:
+            if (progress < 0.5f) {
+                float t = progress * 2.0f;
+                tween.view->setScale(tween.scaleFrom + (tween.scaleTo - tween.scaleFrom) * t);
+            } else {
+                float t = (progress - 0.5f) * 2.0f;
+                tween.view->setScale(tween.scaleTo + (1.0f - tween.scaleTo) * t);
+            }
+            break;
+        case ScaleCurve::NONE:
+            break;
+    }
+}
+
+float CardTweener::easeInOut(float t) {
+    t *= 2.0f;
+    if (t < 1.0f) {
+        return 0.5f * std::pow(t, EASE_RATE);
+    }
+    return 1.0f - 0.5f * std::pow(2.0f - t, EASE_RATE);
+}
@@ -0,0 +1,101 @@
+#ifndef __CARD_TWEENER_H__
+#define __CARD_TWEENER_H__
+
+#include "cocos2d.h"
+#include <functional>
+#include <vector>
+
+class CardView;
+
+/**
+ * @class CardTweener
+ * @brief 卡牌补间动画系统
+ * 
+ * 职责：
+ * - 用一个连续数组保存所有进行中的卡牌补间（位移 + 缩放），由GameView每帧统一推进
+ * - 同一帧完成的补间按类型分批回调，每种类型一次回调
+ * - 数组和完成列表的容量在稳定后复用，播放、推进和完成都不再分配内存
+ * 
+ * 同一张卡牌同时只有一个补间：新补间替换旧补间，被替换的补间在下一次update中按完成回调
+ * （同类型替换时由新补间接续，不回调）；触摸反馈不会替换其他类型的补间。
+ * 回调时卡牌可能已被新补间接管，需要改动卡牌的回调应先检查isTweening。
+ */
+class CardTweener {
+public:
+    enum class Kind {
+        MOVE_TO_TOP,     // 卡牌移动到底牌堆顶部
+        UNDO,            // 回退时卡牌回到原位置
+        MOVE,            // 一般位移
+        MATCH,           // 匹配提示
+        TOUCH_FEEDBACK,  // 按下/抬起缩放
+        COUNT
+    };
+
+    enum class ScaleCurve {
+        NONE,   // 不改变缩放
+        TO,     // 线性缩放到目标值
+        PULSE   // 前半程缩放到目标值，后半程恢复到1.0
+    };
+
+    // 参数为本帧完成的该类型补间对应的卡牌ID
+    using CompletionHandler = std::function<void(const std::vector<int>& cardIds)>;
+
+    CardTweener();
+
+    /**
+     * @brief 设置某类补间的完成回调（初始化时设置一次）
+     */
+    void setCompletionHandler(Kind kind, const CompletionHandler& handler);
+
+    /**
+     * @brief 缓动（EaseInOut）位移到target，同时按scaleCurve缩放
+     */
+    void moveTo(CardView* view, Kind kind, const cocos2d::Vec2& target, float duration,
+                ScaleCurve scaleCurve = ScaleCurve::NONE, float scale = 1.0f);
+
+    /**
+     * @brief 只缩放不位移
+     */
+    void scaleTo(CardView* view, Kind kind, ScaleCurve scaleCurve, float scale, float duration);
+
+    bool isTweening(int cardId) const;
+    bool hasTweens(Kind kind) const;
+    bool empty() const { return _tweens.empty(); }
+
+    /**
+     * @brief 停止全部补间（不回调），用于视图回收前
+     */
+    void cancelAll();
+
+    /**
+     * @brief 推进所有补间，并分批回调本帧完成的补间
+     */
+    void update(float dt);
+
+private:
+    struct Tween {
+        CardView* view;
+        int cardId;
+        Kind kind;
+        float elapsed;
+        float duration;
+        bool moves;
+        cocos2d::Vec2 from;
+        cocos2d::Vec2 to;
+        ScaleCurve scaleCurve;
+        float scaleFrom;
+        float scaleTo;
+    };
+
+    Tween* findTween(int cardId);
+    void start(const Tween& tween);
+    static void apply(const Tween& tween, float progress);
+    static float easeInOut(float t);
+
+    std::vector<Tween> _tweens;
+    std::vector<int> _completed[(int)Kind::COUNT];
+    std::vector<int> _dispatching;  // 正在回调的完成列表
+    CompletionHandler _handlers[(int)Kind::COUNT];
+};
+
+#endif // __CARD_TWEENER_H__
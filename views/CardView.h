@@ -10,8 +10,15 @@ public:
 
     CREATE_FUNC(CardView);
 
+    virtual ~CardView();
     virtual bool init() override;
 
+    // 卡牌尺寸（取自卡牌背景图），与getBoundingBox()使用的尺寸一致
+    static cocos2d::Size getCardSize();
+    
+    // 收集显示一张卡牌所需的全部纹理路径（用于预加载）
+    static void collectTexturePaths(CardFaceType face, CardSuitType suit, std::vector<std::string>& paths);
+
     void setCardId(int cardId) { _cardId = cardId; }
     int getCardId() const { return _cardId; }
 
@@ -19,37 +26,38 @@ public:
         _clickCallback = callback;
     }
 
-    void setClickEnabled(bool enabled);
+    // 触摸由GameView统一分发，这里只保存是否可点击
+    void setClickEnabled(bool enabled) { _clickEnabled = enabled; }
+    bool isClickEnabled() const { return _clickEnabled; }
+    
+    // 回收复用前重置状态（停止动画、恢复缩放、解除模型和回调绑定）
+    void resetForReuse();
     void updateDisplay();
     void setCardModel(const CardModel* cardModel) { _cardModel = cardModel; }
     
-    // 动画功能
-    void playMoveToAnimation(const cocos2d::Vec2& targetPosition, float duration = 0.5f);
-    void playMatchAnimation();
-    
     // 公有方法，用于测试
     void onClicked();
 
 private:
-    void setupTouchEvents();
     // 已废弃：现在使用Cocos2d-x内置的getBoundingBox().containsPoint()
     bool containsTouchPoint_DEPRECATED(cocos2d::Touch* touch);
-    void createCompositeCard();
-    std::string getImagePathForCard(CardFaceType face, CardSuitType suit) const;
-    std::string getBigNumberImagePath(CardFaceType face, CardSuitType suit) const;
-    std::string getSuitImagePath(CardSuitType suit) const;
-    bool isRedSuit(CardSuitType suit) const;
+    void showComposedFace(int faceKey);
+    void releaseComposedFace();
+    void releaseFaceFrame();
+
+    static const int NO_COMPOSED_FACE = -1;
 
     int _cardId;
     ClickCallback _clickCallback;
-    cocos2d::EventListenerTouchOneByOne* _touchListener;
+    bool _clickEnabled;
     const CardModel* _cardModel;
     
-    // ���Ͽ������
-    cocos2d::Sprite* _backgroundSprite;
-    cocos2d::Sprite* _bigNumberSprite;
-    cocos2d::Sprite* _smallNumberSprite;
-    cocos2d::Sprite* _suitSprite;
+    // 预合成牌面不可用时的拼装子节点
+    cocos2d::Node* _composedFace;
+    int _composedFaceKey;
+    
+    // 当前引用的预合成牌面键，未引用时为NO_COMPOSED_FACE
+    int _frameKey;
 };
 
 #endif // __CARD_VIEW_H__
\ No newline at end of file
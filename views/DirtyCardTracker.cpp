@@ -0,0 +1,28 @@
+#include "DirtyCardTracker.h"
+#include <algorithm>
+
+DirtyCardTracker::DirtyCardTracker()
+    : _topCardDirty(false) {
+}
+
+void DirtyCardTracker::collect(GameModel& model) {
+    if (!model.hasChangeEvents()) {
+        return;
+    }
+    
+    model.drainChangeEvents(_pendingEvents);
+    for (const auto& event : _pendingEvents) {
+        if (event.type == GameModel::ChangeEvent::Type::TOP_CARD_CHANGED) {
+            _topCardDirty = true;
+        }
+        if (std::find(_dirtyCardIds.begin(), _dirtyCardIds.end(), event.cardId) == _dirtyCardIds.end()) {
+            _dirtyCardIds.push_back(event.cardId);
+        }
+    }
+    _pendingEvents.clear();
+}
+
+void DirtyCardTracker::clear() {
+    _dirtyCardIds.clear();
+    _topCardDirty = false;
+}
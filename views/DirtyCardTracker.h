@@ -0,0 +1,57 @@
+#ifndef __DIRTY_CARD_TRACKER_H__
+#define __DIRTY_CARD_TRACKER_H__
+
+#include "../models/GameModel.h"
+#include <vector>
+
+/**
+ * @class DirtyCardTracker
+ * @brief 视图增量同步的脏卡牌记录
+ * 
+ * 职责：
+ * - 取出模型变更事件，合并为去重的脏卡牌列表和顶部牌脏标记
+ * - 逐张交给调用方刷新，调用方暂不能刷新的卡牌（例如动画中）保留到下次
+ * - 事件缓冲区与脏列表都复用容量，稳定后每次同步不再分配内存
+ * 
+ * 只依赖模型，GameView和无界面的性能测试共用同一份实现。
+ */
+class DirtyCardTracker {
+public:
+    DirtyCardTracker();
+
+    /**
+     * @brief 取出模型中的全部变更事件并记入脏列表
+     */
+    void collect(GameModel& model);
+
+    bool empty() const { return _dirtyCardIds.empty() && !_topCardDirty; }
+    bool isTopCardDirty() const { return _topCardDirty; }
+    void clearTopCardDirty() { _topCardDirty = false; }
+
+    /**
+     * @brief 对每张脏卡牌调用update(cardId)，返回false的卡牌保留脏标记
+     */
+    template <typename UpdateFn>
+    void consume(UpdateFn update) {
+        size_t kept = 0;
+        for (size_t i = 0; i < _dirtyCardIds.size(); ++i) {
+            int cardId = _dirtyCardIds[i];
+            if (!update(cardId)) {
+                _dirtyCardIds[kept++] = cardId;
+            }
+        }
+        _dirtyCardIds.resize(kept);
+    }
+
+    /**
+     * @brief 丢弃全部脏标记（视图按模型整体重建时）
+     */
+    void clear();
+
+private:
+    std::vector<GameModel::ChangeEvent> _pendingEvents;
+    std::vector<int> _dirtyCardIds;   // 每帧只有几张，线性去重比哈希集合更省，且不按节点分配
+    bool _topCardDirty;
+};
+
+#endif // __DIRTY_CARD_TRACKER_H__
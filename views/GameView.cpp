@@ -2,8 +2,11 @@
 #include "CardView.h"
 #include "../models/GameModel.h"
 #include "../utils/GameUtils.h"
+#include "../utils/GameClock.h"
+#include "../managers/IdleFrameThrottle.h"
 #include "cocos2d.h"
 #include "ui/CocosGUI.h"
+#include <algorithm>
 
 // 包含GameController.h，确保方法可见
 #include "../controllers/GameController.h"
@@ -19,26 +22,68 @@ bool GameView::init() {
     // 使用左下角锚点，这样位置计算更直观
     this->setAnchorPoint(Vec2(0, 0));
     
+    _hitGridDirty = true;
+    _touchedCardId = -1;
+    _toastLayer = nullptr;
+    _idleBusyCheck = 0;
+    
     setupUI();
+    setupCardLayers();
+    setupTouchDispatch();
+    _tweener.setCompletionHandler(CardTweener::Kind::MOVE_TO_TOP, [this](const std::vector<int>& cardIds) {
+        onMoveToTopTweensCompleted(cardIds);
+    });
+    _tweener.setCompletionHandler(CardTweener::Kind::UNDO, [this](const std::vector<int>& cardIds) {
+        onReturnTweensCompleted(cardIds);
+    });
+    
+    // 每帧消费模型变更事件
+    scheduleUpdate();
     return true;
 }
 
-void GameView::initializeWithModel(const GameModel& model) {
-    // 清理现有视图
-    for (auto& kv : _cardViews) {
-        if (kv.second) {
-            kv.second->removeFromParent();
-        }
+void GameView::onEnter() {
+    Node::onEnter();
+    
+    // 有补间、待同步的变更或提示时保持正常帧率
+    _idleBusyCheck = IdleFrameThrottle::addBusyCheck([this]() {
+        GameModel* model = _controller ? _controller->getModel() : nullptr;
+        return !_tweener.empty() || !_dirtyCards.empty() ||
+               (model && model->hasChangeEvents()) ||
+               (_toastLayer && _toastLayer->hasVisibleToasts());
+    });
+}
+
+void GameView::onExit() {
+    if (_idleBusyCheck) {
+        IdleFrameThrottle::removeBusyCheck(_idleBusyCheck);
+        _idleBusyCheck = 0;
     }
-    _cardViews.clear();
+    Node::onExit();
+}
 
+void GameView::initializeWithModel(const GameModel& model, bool buildDependencyGraph) {
+    // 回收现有视图，供新关卡复用
+    recycleCardViews();
+    
+    // 视图直接按模型当前状态创建，此前积累的变更事件已无意义
+    _dirtyCards.clear();
+    _hitGridDirty = true;
+    _touchedCardId = -1;
+    if (_controller && _controller->getModel()) {
+        _controller->getModel()->clearChangeEvents();
+    }
+
+    // 先算出本关全部卡牌的位置，再创建视图
+    _boardLayout.build(model);
+    
     // 创建所有卡牌视图
     createCardViews(model.getPlayfieldCardIds(), model);
     createCardViews(model.getStackCardIds(), model);
     createCardViews(model.getBottomCardIds(), model);
     
-    // 构建依赖图
-    if (_controller && _controller->getModel()) {
+    // 构建依赖图（从存档恢复时依赖图已随存档载入）
+    if (buildDependencyGraph && _controller && _controller->getModel()) {
         std::unordered_map<int, CardView*> cardViewPtrs;
         for (const auto& pair : _cardViews) {
             cardViewPtrs[pair.first] = pair.second.get();
@@ -49,6 +94,73 @@ void GameView::initializeWithModel(const GameModel& model) {
     updateTopCardDisplay();
 }
 
+CardView* GameView::acquireCardView() {
+    if (_cardViewPool.empty()) {
+        return CardView::create();
+    }
+    
+    // 与create()返回的对象一致：交由自动释放池持有，直到被addChild保留
+    CardView* cardView = _cardViewPool.back().get();
+    cardView->retain();
+    cardView->autorelease();
+    _cardViewPool.pop_back();
+    return cardView;
+}
+
+void GameView::recycleCardViews() {
+    // 视图即将复用，进行中的补间直接丢弃
+    _tweener.cancelAll();
+    
+    _cardViewPool.reserve(_cardViewPool.size() + _cardViews.size());
+    for (auto& kv : _cardViews) {
+        CardView* cardView = kv.second.get();
+        if (!cardView) continue;
+        
+        cardView->removeFromParent();
+        cardView->resetForReuse();
+        _cardViewPool.push_back(kv.second);
+    }
+    _cardViews.clear();
+}
+
+void GameView::setupCardLayers() {
+    const int layerZOrders[(int)CardLayer::COUNT] = {
+        GameUtils::STACK_ZORDER_BASE,
+        GameUtils::PLAYFIELD_ZORDER_BASE,
+        GameUtils::BOTTOM_PILE_ZORDER_BASE,
+        GameUtils::MOVING_CARD_ZORDER
+    };
+    
+    // 层节点位于原点且不做变换，卡牌的位置和包围盒仍是GameView坐标
+    for (int i = 0; i < (int)CardLayer::COUNT; ++i) {
+        _cardLayers[i] = Node::create();
+        this->addChild(_cardLayers[i], layerZOrders[i]);
+    }
+}
+
+void GameView::setCardViewZOrder(CardView* cardView, int zOrder) {
+    // 从最高的区段往下找：层级值落在哪个区段就挂到哪一层
+    int layerIndex = (int)CardLayer::COUNT - 1;
+    while (layerIndex > 0 && zOrder < _cardLayers[layerIndex]->getLocalZOrder()) {
+        --layerIndex;
+    }
+    
+    Node* layer = _cardLayers[layerIndex];
+    int localZOrder = zOrder - layer->getLocalZOrder();
+    if (cardView->getParent() != layer) {
+        // 换层：视图由_cardViews持有，移出旧层时不会被释放
+        cardView->removeFromParentAndCleanup(false);
+        layer->addChild(cardView, localZOrder);
+    } else if (cardView->getLocalZOrder() != localZOrder) {
+        cardView->setLocalZOrder(localZOrder);
+    }
+}
+
+int GameView::getCardViewZOrder(const CardView* cardView) const {
+    const Node* layer = cardView->getParent();
+    return layer ? layer->getLocalZOrder() + cardView->getLocalZOrder() : cardView->getLocalZOrder();
+}
+
 void GameView::createCardViews(const std::vector<int>& cardIds, const GameModel& model) {
     for (int cardId : cardIds) {
         const CardModel* cm = model.getCard(cardId);
@@ -76,62 +188,130 @@ void GameView::setupUI() {
     this->addChild(stackBg, -100);
     
     // 添加区域标签
-    auto playfieldLabel = Label::createWithTTF("Playfield", "fonts/arial.ttf", 24);
+    auto playfieldLabel = GameUtils::createUILabel("Playfield", 24);
     playfieldLabel->setPosition(540, 1330);
     playfieldLabel->setColor(Color3B::WHITE);
     this->addChild(playfieldLabel, 1);
     
-    auto stackLabel = Label::createWithTTF("Stack", "fonts/arial.ttf", 24);
+    auto stackLabel = GameUtils::createUILabel("Stack", 24);
     stackLabel->setPosition(540, 290);
     stackLabel->setColor(Color3B::WHITE);
     this->addChild(stackLabel, 1);
     
-    // 添加回退按钮
+    // 添加回退和重做按钮
     createUndoButton();
+    createRedoButton();
+#if COCOS2D_DEBUG > 0
+    createSpeedButton();
+#endif
+    
+    // 提示层
+    _toastLayer = ToastLayer::create();
+    this->addChild(_toastLayer, 100);
 }
 
 void GameView::createUndoButton() {
     CCLOG("Creating undo button...");
     
+    // 移动到更右边，避免被卡牌遮挡
+    createControlButton("Undo", Vec2(1000, 300), [this]() {
+        // 执行回退（控制器内部会检查是否有可回退的操作）
+        if (_controller) {
+            CCLOG("Calling controller handleUndo");
+            _controller->handleUndo();
+        } else {
+            CCLOGERROR("Controller is null!");
+        }
+    });
+    
+    CCLOG("Undo button created successfully at position (1000, 300)");
+    CCLOG("Button size: 120x60, Controller status: %s", _controller ? "SET" : "NULL");
+}
+
+void GameView::createRedoButton() {
+    CCLOG("Creating redo button...");
+    
+    // 位于回退按钮上方
+    createControlButton("Redo", Vec2(1000, 380), [this]() {
+        if (_controller) {
+            CCLOG("Calling controller handleRedo");
+            _controller->handleRedo();
+        } else {
+            CCLOGERROR("Controller is null!");
+        }
+    });
+    
+    CCLOG("Redo button created successfully at position (1000, 380)");
+}
+
+void GameView::createSpeedButton() {
+    // 位于重做按钮上方；倍速只影响补间和回退冷却，不受冷却限制
+    createControlButton("Speed", Vec2(1000, 460), [this]() {
+        GameClock::Speed next = GameClock::Speed::NORMAL;
+        const char* text = "Speed 1x";
+        switch (GameClock::getSpeed()) {
+        case GameClock::Speed::NORMAL:
+            next = GameClock::Speed::FAST;
+            text = "Speed 4x";
+            break;
+        case GameClock::Speed::FAST:
+            next = GameClock::Speed::TURBO;
+            text = "Speed 32x";
+            break;
+        case GameClock::Speed::TURBO:
+            next = GameClock::Speed::INSTANT;
+            text = "Speed instant";
+            break;
+        case GameClock::Speed::INSTANT:
+            break;
+        }
+        
+        GameClock::setSpeed(next);
+        showToast(text, Vec2(1000, 520), Color3B::YELLOW);
+    }, false);
+}
+
+void GameView::createControlButton(const std::string& title, const Vec2& position,
+                                   const std::function<void()>& onClick, bool useUndoCooldown) {
     // 使用更简单的方法：直接创建一个可点击的Node
-    auto undoButton = Node::create();
-    undoButton->setContentSize(Size(120, 60));
-    undoButton->setPosition(Vec2(1000, 300)); // 移动到更右边，避免被卡牌遮挡
-    undoButton->setAnchorPoint(Vec2(0.5f, 0.5f));
+    auto button = Node::create();
+    button->setContentSize(Size(120, 60));
+    button->setPosition(position);
+    button->setAnchorPoint(Vec2(0.5f, 0.5f));
     
     // 创建按钮背景
     auto buttonBg = LayerColor::create(Color4B(100, 100, 200, 255), 120, 60);
     buttonBg->setPosition(-60, -30); // 相对于按钮中心
     buttonBg->setAnchorPoint(Vec2(0, 0));
-    undoButton->addChild(buttonBg, -1);
+    button->addChild(buttonBg, -1);
     
     // 创建按钮文字
-    auto buttonLabel = Label::createWithTTF("Undo", "fonts/arial.ttf", 20);
+    auto buttonLabel = GameUtils::createUILabel(title, 20);
     buttonLabel->setPosition(0, 0); // 按钮中心
     buttonLabel->setColor(Color3B::WHITE);
-    undoButton->addChild(buttonLabel, 1);
+    button->addChild(buttonLabel, 1);
     
     // 设置触摸事件监听器
     auto touchListener = EventListenerTouchOneByOne::create();
     touchListener->setSwallowTouches(true);
     
-    touchListener->onTouchBegan = [this, undoButton, buttonBg, buttonLabel](Touch* touch, Event* event) -> bool {
+    touchListener->onTouchBegan = [this, button, buttonBg, buttonLabel, useUndoCooldown](Touch* touch, Event* /*event*/) -> bool {
         // 检查时间锁
-        if (_controller && !_controller->canUndo()) {
-            CCLOG("Undo button touch ignored - cooldown time not reached");
+        if (useUndoCooldown && _controller && !_controller->canUndo()) {
+            CCLOG("Button touch ignored - cooldown time not reached");
             return false; // 不消费触摸事件
         }
         
         // 检查触摸点是否在按钮范围内
         Vec2 touchLocation = touch->getLocation();
-        Vec2 buttonPos = undoButton->getPosition();
+        Vec2 buttonPos = button->getPosition();
         Rect buttonRect = Rect(buttonPos.x - 60, buttonPos.y - 30, 120, 60);
         
         if (buttonRect.containsPoint(touchLocation)) {
-            CCLOG("Undo button touched at (%.1f, %.1f)", touchLocation.x, touchLocation.y);
+            CCLOG("Button touched at (%.1f, %.1f)", touchLocation.x, touchLocation.y);
             
             // 按压效果
-            undoButton->runAction(ScaleTo::create(0.1f, 0.9f));
+            button->runAction(ScaleTo::create(0.1f, 0.9f));
             buttonBg->setColor(Color3B(80, 80, 160));
             buttonLabel->setColor(Color3B(200, 200, 200));
             
@@ -140,112 +320,183 @@ void GameView::createUndoButton() {
         return false;
     };
     
-    touchListener->onTouchEnded = [this, undoButton, buttonBg, buttonLabel](Touch* touch, Event* event) {
-        CCLOG("Undo button touch ended");
-        
-        // 检查时间锁
-        if (_controller && !_controller->canUndo()) {
-            CCLOG("Undo button click ignored - cooldown time not reached");
-            // 恢复效果
-            undoButton->runAction(ScaleTo::create(0.1f, 1.0f));
-            buttonBg->setColor(Color3B(100, 100, 200));
-            buttonLabel->setColor(Color3B::WHITE);
-            return;
-        }
+    touchListener->onTouchEnded = [this, button, buttonBg, buttonLabel, onClick, useUndoCooldown](Touch* /*touch*/, Event* /*event*/) {
+        CCLOG("Button touch ended");
         
         // 恢复效果
-        undoButton->runAction(ScaleTo::create(0.1f, 1.0f));
+        button->runAction(ScaleTo::create(0.1f, 1.0f));
         buttonBg->setColor(Color3B(100, 100, 200));
         buttonLabel->setColor(Color3B::WHITE);
         
-        // 执行回退（控制器内部会检查是否有可回退的操作）
-        if (_controller) {
-            CCLOG("Calling controller handleUndo");
-            _controller->handleUndo();
-        } else {
-            CCLOGERROR("Controller is null!");
+        // 检查时间锁
+        if (useUndoCooldown && _controller && !_controller->canUndo()) {
+            CCLOG("Button click ignored - cooldown time not reached");
+            return;
         }
+        
+        onClick();
     };
     
-    touchListener->onTouchCancelled = [this, undoButton, buttonBg, buttonLabel](Touch* touch, Event* event) {
-        CCLOG("Undo button touch cancelled");
+    touchListener->onTouchCancelled = [button, buttonBg, buttonLabel](Touch* /*touch*/, Event* /*event*/) {
+        CCLOG("Button touch cancelled");
         
         // 恢复效果
-        undoButton->runAction(ScaleTo::create(0.1f, 1.0f));
+        button->runAction(ScaleTo::create(0.1f, 1.0f));
         buttonBg->setColor(Color3B(100, 100, 200));
         buttonLabel->setColor(Color3B::WHITE);
     };
     
     // 注册触摸监听器
-    _eventDispatcher->addEventListenerWithSceneGraphPriority(touchListener, undoButton);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(touchListener, button);
     
     // 添加到场景
-    this->addChild(undoButton, 100);
+    this->addChild(button, 100);
+}
+
+void GameView::setupTouchDispatch() {
+    auto touchListener = EventListenerTouchOneByOne::create();
+    touchListener->setSwallowTouches(true);
     
-    CCLOG("Undo button created successfully at position (1000, 300)");
-    CCLOG("Button size: 120x60, Controller status: %s", _controller ? "SET" : "NULL");
+    // 按下：只有触点落在可点击的卡牌上才消费此触摸，其余交给按钮等其他监听器
+    touchListener->onTouchBegan = [this](Touch* touch, Event* /*event*/) -> bool {
+        if (!touch) {
+            return false;
+        }
+        
+        CardView* cardView = findCardAt(this->convertToNodeSpace(touch->getLocation()));
+        if (!cardView) {
+            return false;
+        }
+        
+        _touchedCardId = cardView->getCardId();
+        CCLOG("CardView %d touched", _touchedCardId);
+        _tweener.scaleTo(cardView, CardTweener::Kind::TOUCH_FEEDBACK, CardTweener::ScaleCurve::TO, 0.95f, 0.1f);
+        return true;
+    };
+    
+    // 抬起：仍在按下的那张卡牌区域内才算点击
+    touchListener->onTouchEnded = [this](Touch* touch, Event* /*event*/) {
+        CardView* cardView = getCardView(_touchedCardId);
+        _touchedCardId = -1;
+        if (!cardView) {
+            return;
+        }
+        
+        _tweener.scaleTo(cardView, CardTweener::Kind::TOUCH_FEEDBACK, CardTweener::ScaleCurve::TO, 1.0f, 0.1f);
+        if (cardView->getBoundingBox().containsPoint(this->convertToNodeSpace(touch->getLocation()))) {
+            cardView->onClicked();
+        }
+    };
+    
+    touchListener->onTouchCancelled = [this](Touch* /*touch*/, Event* /*event*/) {
+        CardView* cardView = getCardView(_touchedCardId);
+        _touchedCardId = -1;
+        if (cardView) {
+            _tweener.scaleTo(cardView, CardTweener::Kind::TOUCH_FEEDBACK, CardTweener::ScaleCurve::TO, 1.0f, 0.1f);
+        }
+    };
+    
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(touchListener, this);
+}
+
+void GameView::rebuildHitGrid() {
+    // 格子取最大卡牌尺寸，每张卡牌最多登记到4个格子中
+    float cellSize = 0.0f;
+    for (const auto& pair : _cardViews) {
+        CardView* cardView = pair.second.get();
+        if (cardView && cardView->getParent()) {
+            const Rect box = cardView->getBoundingBox();
+            cellSize = std::max(cellSize, std::max(box.size.width, box.size.height));
+        }
+    }
+    
+    _hitGrid.reset(cellSize);
+    for (const auto& pair : _cardViews) {
+        CardView* cardView = pair.second.get();
+        if (cardView && cardView->getParent()) {
+            _hitGrid.insert(pair.first, getCardViewZOrder(cardView), cardView->getBoundingBox());
+        }
+    }
+    _hitGrid.finalize();
+    _hitGridDirty = false;
+}
+
+CardView* GameView::findCardAt(const Vec2& location) {
+    if (_hitGridDirty) {
+        rebuildHitGrid();
+    }
+    
+    const std::vector<CardHitGrid::Entry>* candidates = _hitGrid.query(location);
+    if (!candidates) {
+        return nullptr;
+    }
+    
+    // 候选已按层级从高到低排列，用卡牌当前包围盒确认命中
+    for (const auto& entry : *candidates) {
+        CardView* cardView = getCardView(entry.cardId);
+        if (cardView && cardView->getParent() && cardView->isVisible() && cardView->isClickEnabled() &&
+            cardView->getBoundingBox().containsPoint(location)) {
+            return cardView;
+        }
+    }
+    return nullptr;
 }
 
-void GameView::updateAllCardViews() {
-    CCLOG("Updating all card views for undo");
+void GameView::update(float dt) {
+    Node::update(dt);
+    
+    // 补间按固定步长推进：倍速只改变本帧的步数，瞬时档推进到动画全部完成为止
+    int steps = GameClock::beginFrame(dt);
+    for (int i = 0; i < steps; ++i) {
+        if (GameClock::isInstant() && _tweener.empty()) {
+            break;
+        }
+        GameClock::step();
+        _tweener.update(GameClock::FIXED_STEP);
+    }
     
+    syncDirtyCardViews();
+}
+
+void GameView::showToast(const std::string& text, const Vec2& position, const Color3B& color) {
+    if (_toastLayer) {
+        _toastLayer->show(text, position, color);
+    }
+}
+
+void GameView::syncDirtyCardViews() {
     if (!_controller || !_controller->getModel()) {
-        CCLOGERROR("Controller or model is null, cannot update card views");
         return;
     }
     
     GameModel* model = _controller->getModel();
+    _dirtyCards.collect(*model);
+    if (_dirtyCards.empty()) {
+        return;
+    }
     
-    // 更新所有卡牌视图的位置和状态
-    for (auto& pair : _cardViews) {
-        if (pair.second) {
-            CardView* cardView = pair.second.get();
-            if (cardView && cardView->getParent()) {
-                int cardId = pair.first;
-                CardModel* cardModel = model->getCard(cardId);
-                
-                if (cardModel) {
-                    // 应用与createCardView相同的位置调整逻辑
-                    Vec2 pos = cardModel->getPosition();
-                    
-                    if (cardModel->isInPlayfield()) {
-                        // 游戏区域卡牌：将y坐标向上调整，让卡牌位置更高
-                        pos.y += 500.0f; // 将原始y坐标向上移动500像素
-                    } else {
-                        // 手牌区卡牌：如果位置为0，使用默认布局
-                        if (pos == Vec2::ZERO) {
-                            // 计算手牌区卡牌的索引（从0开始）
-                            int stackIndex = cardId - 1006; // 假设手牌区卡牌ID从1006开始
-                            float baseX = 200.0f + stackIndex * 120.0f; // 从x=200开始，间隔120像素
-                            float baseY = 300.0f;
-                            pos = Vec2(baseX, baseY);
-                        }
-                    }
-                    
-                    // 同步卡牌位置
-                    cardView->setPosition(pos);
-                    
-                    // 同步卡牌层级：根据JSON顺序设置层级
-                    int zOrder;
-                    if (cardModel->isInPlayfield()) {
-                        int jsonOrder = getCardJsonOrder(cardId);
-                        zOrder = 2000 + jsonOrder; // JSON顺序越靠后，zOrder越高
-                    } else {
-                        zOrder = 1000; // 手牌区卡牌正常层级
-                    }
-                    cardView->setZOrder(zOrder);
-                    
-                    // 更新卡牌显示
-                    cardView->updateDisplay();
-                    
-                    CCLOG("Updated card view %d: modelPos(%.1f, %.1f) -> viewPos(%.1f, %.1f), zOrder(%d)", 
-                          cardId, cardModel->getPosition().x, cardModel->getPosition().y, pos.x, pos.y, zOrder);
-                }
-            }
+    // 正在播放动画的卡牌保留脏标记，由动画回调负责终点状态，结束后的下一帧再同步
+    _dirtyCards.consume([this](int cardId) {
+        if (_tweener.isTweening(cardId)) {
+            return false;
         }
-    }
+        updateCardView(cardId);
+        return true;
+    });
     
-    CCLOG("All card views updated");
+    if (_dirtyCards.isTopCardDirty()) {
+        const CardModel* topCard = model->getTopCard();
+        if (!topCard || !_tweener.isTweening(topCard->getCardId())) {
+            updateTopCardDisplay();
+            _dirtyCards.clearTopCardDirty();
+        }
+    }
+}
+
+void GameView::rebuildBoardLayout() {
+    if (_controller && _controller->getModel()) {
+        _boardLayout.build(*_controller->getModel());
+    }
 }
 
 CardView* GameView::getCardView(int cardId) {
@@ -257,7 +508,37 @@ CardView* GameView::getCardView(int cardId) {
 }
 
 void GameView::updateCardView(int cardId) {
-    // 更新指定卡牌的显示
+    if (!_controller || !_controller->getModel()) {
+        return;
+    }
+    
+    CardView* cardView = getCardView(cardId);
+    if (!cardView || !cardView->getParent()) {
+        return;
+    }
+    
+    GameModel* model = _controller->getModel();
+    CardModel* cardModel = model->getCard(cardId);
+    if (!cardModel) {
+        return;
+    }
+    
+    // 按卡牌当前所在牌堆查位置表
+    Vec2 pos = _boardLayout.getPosition(cardId, *model);
+    
+    // 同步卡牌位置
+    cardView->setPosition(pos);
+    _hitGridDirty = true;
+    
+    // 同步卡牌层级
+    int zOrder = GameUtils::calculateSyncZOrder(cardId, model);
+    setCardViewZOrder(cardView, zOrder);
+    
+    // 更新卡牌显示
+    cardView->updateDisplay();
+    
+    CCLOG("Updated card view %d: modelPos(%.1f, %.1f) -> viewPos(%.1f, %.1f), zOrder(%d)", 
+          cardId, cardModel->getPosition().x, cardModel->getPosition().y, pos.x, pos.y, zOrder);
 }
 
 void GameView::createCardView(const CardModel& cardModel) {
@@ -268,7 +549,7 @@ void GameView::createCardView(const CardModel& cardModel) {
         return;
     }
     
-    auto cardView = CardView::create();
+    auto cardView = acquireCardView();
     if (!cardView) return;
 
     // 设置卡牌模型和更新显示
@@ -276,24 +557,10 @@ void GameView::createCardView(const CardModel& cardModel) {
     cardView->setCardId(cardModel.getCardId());
     cardView->updateDisplay();
 
-    // 位置：根据卡牌类型调整位置
-    Vec2 pos = cardModel.getPosition();
-    
-    if (cardModel.isInPlayfield()) {
-        // 游戏区域卡牌：将y坐标向上调整，让卡牌位置更高
-        pos.y += 500.0f; // 将原始y坐标向上移动500像素
-    } else {
-        // 手牌区卡牌：如果位置为0，使用默认布局
-        if (pos == Vec2::ZERO) {
-            // 计算手牌区卡牌的索引（从0开始）
-            int stackIndex = cardModel.getCardId() - 1006; // 假设手牌区卡牌ID从1006开始
-            float baseX = 200.0f + stackIndex * 120.0f; // 从x=200开始，间隔120像素
-            float baseY = 300.0f;
-            pos = Vec2(baseX, baseY);
-        }
+    // 位置：按卡牌当前所在牌堆查位置表
+    if (_controller && _controller->getModel()) {
+        cardView->setPosition(_boardLayout.getPosition(cardId, *_controller->getModel()));
     }
-    
-    cardView->setPosition(pos);
 
     // 设置点击回调
     if (_controller) {
@@ -310,92 +577,163 @@ void GameView::createCardView(const CardModel& cardModel) {
         CCLOGERROR("Controller is null, cannot set click callback for card %d", cardModel.getCardId());
     }
 
-    // 添加到场景
-    this->addChild(cardView);
-    
-    // 使用工具类设置正确的层级顺序
+    // 使用工具类设置正确的层级顺序，同时加入对应的牌堆层
     int zOrder = GameUtils::calculateCorrectZOrder(cardModel.getCardId(), _controller->getModel());
-    cardView->setZOrder(zOrder);
+    setCardViewZOrder(cardView, zOrder);
     CCLOG("Card %d: zOrder=%d", cardModel.getCardId(), zOrder);
     
     _cardViews[cardModel.getCardId()] = cardView;
-}
-
-int GameView::getCardJsonOrder(int cardId) {
-    return GameUtils::getCardJsonOrder(cardId, _controller->getModel());
+    _hitGridDirty = true;
 }
 
 void GameView::playCardMoveAnimation(int cardId, const Vec2& targetPosition) {
     auto cardView = getCardView(cardId);
     if (cardView) {
-        cardView->playMoveToAnimation(targetPosition);
+        // 设置移动中的卡牌为最高层级
+        setCardViewZOrder(cardView, GameUtils::MOVING_CARD_ZORDER);
+        _tweener.moveTo(cardView, CardTweener::Kind::MOVE, targetPosition, GameUtils::ANIMATION_DURATION,
+                        CardTweener::ScaleCurve::PULSE, GameUtils::CARD_SCALE_FACTOR);
     }
 }
 
 void GameView::playMatchAnimation(int cardId) {
     auto cardView = getCardView(cardId);
     if (cardView) {
-        cardView->playMatchAnimation();
+        _tweener.scaleTo(cardView, CardTweener::Kind::MATCH, CardTweener::ScaleCurve::PULSE, 1.2f, 0.2f);
     }
 }
 
-void GameView::playCardMoveToTopAnimation(int cardId, const cocos2d::Vec2& originalPosition) {
+bool GameView::playCardMoveToTopAnimation(int cardId, const cocos2d::Vec2& originalPosition) {
+    CC_UNUSED_PARAM(originalPosition);   // 只在调试日志中使用，动画起点取视图当前位置
     CCLOG("Playing card move to top animation for card: %d", cardId);
     
     auto cardView = getCardView(cardId);
     if (!cardView) {
         CCLOGERROR("CardView not found for card: %d", cardId);
-        return;
+        return false;
     }
     
     // 设置移动中的卡牌为最高层级
-    cardView->setZOrder(GameUtils::MOVING_CARD_ZORDER);
+    setCardViewZOrder(cardView, GameUtils::MOVING_CARD_ZORDER);
     CCLOG("Card %d set to moving zOrder=%d", cardId, GameUtils::MOVING_CARD_ZORDER);
     
     // 设置目标位置（手牌区顶部）
-    Vec2 targetPosition = Vec2(GameUtils::TOP_CARD_X, GameUtils::TOP_CARD_Y);
+    Vec2 targetPosition = BoardLayout::getBottomSlot();
     
-    // 创建移动动画
-    auto moveAction = MoveTo::create(GameUtils::ANIMATION_DURATION, targetPosition);
-    auto easeAction = EaseInOut::create(moveAction, 2.0f);
+    // 缓动移动，同时稍微放大；完成后由onMoveToTopTweensCompleted收尾
+    _tweener.moveTo(cardView, CardTweener::Kind::MOVE_TO_TOP, targetPosition, GameUtils::ANIMATION_DURATION,
+                    CardTweener::ScaleCurve::TO, GameUtils::CARD_SCALE_FACTOR);
     
-    // 创建缩放动画（移动到顶部时稍微放大）
-    auto scaleAction = ScaleTo::create(GameUtils::ANIMATION_DURATION, GameUtils::CARD_SCALE_FACTOR);
+    CCLOG("Card %d move animation started from (%.1f, %.1f) to (%.1f, %.1f)", 
+          cardId, originalPosition.x, originalPosition.y, targetPosition.x, targetPosition.y);
+    return true;
+}
+
+bool GameView::playCardReturnAnimation(int cardId) {
+    CardView* cardView = getCardView(cardId);
+    if (!cardView || !_controller || !_controller->getModel()) {
+        CCLOG("CardView not found for card %d, skipping animation", cardId);
+        return false;
+    }
     
-    // 组合移动和缩放动画
-    auto spawnAction = Spawn::create(easeAction, scaleAction, nullptr);
+    // 目标位置取自本关位置表
+    Vec2 modelPos = _boardLayout.getPosition(cardId, *_controller->getModel());
+    Vec2 viewPos = cardView->getPosition();
     
-    // 动画完成回调
-    auto callback = CallFunc::create([this, cardId]() {
-        CCLOG("Card %d move to top animation completed", cardId);
-        
-        // 动画完成后设置正确的层级
-        if (_controller && _controller->getModel()) {
+    // 只有当视图位置与模型位置不同时才播放动画
+    if (viewPos == modelPos) {
+        return false;
+    }
+    
+    CCLOG("Card %d needs animation: view(%.1f,%.1f) -> model(%.1f,%.1f)", 
+          cardId, viewPos.x, viewPos.y, modelPos.x, modelPos.y);
+    
+    // 设置移动中的卡牌为最高层级
+    setCardViewZOrder(cardView, GameUtils::MOVING_CARD_ZORDER);
+    
+    // 缓动移动，前半程放大、后半程恢复；完成后在onReturnTweensCompleted中恢复层级
+    _tweener.moveTo(cardView, CardTweener::Kind::UNDO, modelPos, GameUtils::ANIMATION_DURATION,
+                    CardTweener::ScaleCurve::PULSE, GameUtils::CARD_SCALE_FACTOR);
+    return true;
+}
+
+bool GameView::isPlayingReturnAnimations() const {
+    return _tweener.hasTweens(CardTweener::Kind::UNDO);
+}
+
+void GameView::setReturnAnimationsCompletedCallback(const std::function<void()>& callback) {
+    _returnAnimationsCompleted = callback;
+}
+
+void GameView::onReturnTweensCompleted(const std::vector<int>& cardIds) {
+    if (_controller && _controller->getModel()) {
+        for (int cardId : cardIds) {
+            // 被新补间接管的卡牌保持移动层级
+            CardView* cardView = getCardView(cardId);
+            if (!cardView || _tweener.isTweening(cardId)) {
+                continue;
+            }
+            
+            int correctZOrder = GameUtils::calculateCorrectZOrder(cardId, _controller->getModel());
+            setCardViewZOrder(cardView, correctZOrder);
+            CCLOG("Card %d undo animation completed with zOrder=%d", cardId, correctZOrder);
+        }
+    }
+    _hitGridDirty = true;
+    
+    if (_returnAnimationsCompleted) {
+        _returnAnimationsCompleted();
+    }
+}
+
+void GameView::refreshCardDisplay(int cardId) {
+    CardView* cardView = getCardView(cardId);
+    if (cardView) {
+        cardView->updateDisplay();
+    }
+}
+
+void GameView::restoreCardZOrders() {
+    if (!_controller || !_controller->getModel()) {
+        return;
+    }
+    
+    // 层级由模型的层级表直接给出，整个过程是一次线性遍历
+    GameModel* model = _controller->getModel();
+    for (auto& pair : _cardViews) {
+        CardView* cardView = pair.second.get();
+        if (cardView && cardView->getParent() && !_tweener.isTweening(pair.first)) {
+            setCardViewZOrder(cardView, GameUtils::calculateCorrectZOrder(pair.first, model));
+        }
+    }
+    _hitGridDirty = true;
+    
+    CCLOG("GameView::restoreCardZOrders - Restored %d card z-orders", (int)_cardViews.size());
+}
+
+
+void GameView::onMoveToTopTweensCompleted(const std::vector<int>& cardIds) {
+    // 动画完成后设置正确的层级
+    if (_controller && _controller->getModel()) {
+        for (int cardId : cardIds) {
+            CCLOG("Card %d move to top animation completed", cardId);
             int correctZOrder = GameUtils::calculateCorrectZOrder(cardId, _controller->getModel());
             auto cardView = this->getCardView(cardId);
-            if (cardView) {
-                cardView->setZOrder(correctZOrder);
+            if (cardView && !_tweener.isTweening(cardId)) {
+                setCardViewZOrder(cardView, correctZOrder);
                 CCLOG("Card %d animation completed with zOrder=%d", cardId, correctZOrder);
             }
         }
-        
-        // 更新顶部牌显示
-        this->updateTopCardDisplay();
-        // 重置动画状态 - 通过GameController重置CardController的状态
-        if (_controller) {
-            _controller->setAnimationPlaying(false);
-            CCLOG("Animation state reset to false");
-        }
-    });
-    
-    auto sequence = Sequence::create(spawnAction, callback, nullptr);
-    cardView->runAction(sequence);
+    }
     
-    CCLOG("Card %d move animation started from (%.1f, %.1f) to (%.1f, %.1f)", 
-          cardId, originalPosition.x, originalPosition.y, targetPosition.x, targetPosition.y);
+    // 更新顶部牌显示
+    this->updateTopCardDisplay();
+    // 重置动画状态并检查关卡是否完成 - 通过GameController重置CardController的状态
+    if (_controller) {
+        _controller->onMoveAnimationCompleted();
+    }
 }
 
-
 void GameView::updateTopCardDisplay() {
     if (!_controller) {
         CCLOGERROR("Controller is null in updateTopCardDisplay");
@@ -420,22 +758,15 @@ void GameView::updateTopCardDisplay() {
         return;
     }
     
-    // 创建容器的副本以避免并发访问问题
-    auto cardViewsCopy = _cardViews;
+    // 直接查表：视图表只在initializeWithModel中增删，这里只改一张视图的属性，无需拷贝容器
+    CardView* topCardView = getCardView(topCardId);
+    if (topCardView && topCardView->getParent() && !_tweener.isTweening(topCardId)) {
+        topCardView->setPosition(BoardLayout::getBottomSlot());
+        topCardView->setScale(1.0f);
         
-        // 设置顶部牌
-        auto it = cardViewsCopy.find(topCardId);
-        if (it != cardViewsCopy.end() && it->second) {
-            CardView* topCardView = it->second.get();
-            
-            if (topCardView && topCardView->getParent()) {
-                Vec2 pos = Vec2(GameUtils::TOP_CARD_X, GameUtils::TOP_CARD_Y);
-                topCardView->setPosition(pos);
-                topCardView->setScale(1.0f);
-                
-                // 顶部牌应该使用底牌堆的最高层级
-                int zOrder = GameUtils::calculateCorrectZOrder(topCardId, _controller->getModel());
-                topCardView->setZOrder(zOrder);
-            }
-        }
+        // 顶部牌应该使用底牌堆的最高层级
+        int zOrder = GameUtils::calculateCorrectZOrder(topCardId, gameModel);
+        setCardViewZOrder(topCardView, zOrder);
+        _hitGridDirty = true;
+    }
 }
@@ -3,6 +3,13 @@
 
 #include "cocos2d.h"
 #include "CardView.h"
+#include "CardHitGrid.h"
+#include "BoardLayout.h"
+#include "CardTweener.h"
+#include "ToastLayer.h"
+#include "GameViewInterface.h"
+#include "DirtyCardTracker.h"
+#include "../models/GameModel.h"
 
 // 前向声明
 class GameModel;
@@ -11,13 +18,15 @@ class CardModel;
 // 包含完整的GameController头文件，因为需要调用其方法
 #include "../controllers/GameController.h"
 
-class GameView : public cocos2d::Node {
+class GameView : public cocos2d::Node, public GameViewInterface {
 public:
     CREATE_FUNC(GameView);
 
     virtual bool init() override;
+    virtual void onEnter() override;
+    virtual void onExit() override;
 
-    void initializeWithModel(const GameModel& model);
+    void initializeWithModel(const GameModel& model, bool buildDependencyGraph = true);
     void setController(GameController* controller) { _controller = controller; }
 
     CardView* getCardView(int cardId);
@@ -27,11 +36,14 @@ public:
     void playCardMoveAnimation(int cardId, const cocos2d::Vec2& targetPosition);
     void playMatchAnimation(int cardId);
     
-    // 卡牌移动到顶部动画
-    void playCardMoveToTopAnimation(int cardId, const cocos2d::Vec2& originalPosition);
-    
-    // 顶部牌显示
-    void updateTopCardDisplay();
+    // GameViewInterface：控制器只通过这些方法操作视图
+    bool playCardMoveToTopAnimation(int cardId, const cocos2d::Vec2& originalPosition) override;
+    bool playCardReturnAnimation(int cardId) override;
+    bool isPlayingReturnAnimations() const override;
+    void setReturnAnimationsCompletedCallback(const std::function<void()>& callback) override;
+    void refreshCardDisplay(int cardId) override;
+    void updateTopCardDisplay() override;
+    void restoreCardZOrders() override;
     
     // 测试点击功能
     void testClickFunctionality();
@@ -39,18 +51,67 @@ public:
     // 调试方法
     void debugContainerState();
     
-    // 回退功能相关方法
-    void updateAllCardViews();
+    // 增量同步：消费模型变更事件，只刷新脏卡牌（动画中的卡牌顺延到动画结束后的帧）
+    void syncDirtyCardViews();
+    virtual void update(float dt) override;
     const std::unordered_map<int, cocos2d::RefPtr<CardView>>& getCardViews() const { return _cardViews; }
+    
+    // 卡牌补间动画：所有卡牌动画都经由此系统，在update中统一推进
+    CardTweener& getTweener() { return _tweener; }
+    
+    // 本关卡牌位置表：initializeWithModel时构建，卡牌位置配置变化后调用rebuildBoardLayout
+    const BoardLayout& getBoardLayout() const { return _boardLayout; }
+    void rebuildBoardLayout();
+    
+    // 提示信息：复用提示层中的固定标签，可随意频繁调用
+    void showToast(const std::string& text, const cocos2d::Vec2& position, const cocos2d::Color3B& color);
 
 private:
     void setupUI();
+    
+    // 牌堆层：卡牌按层级区段挂在备用牌堆/主牌堆/底牌堆/移动中四个层节点下，
+    // 层节点的层级就是区段基础值，改卡牌层级时只重排所在层的卡牌
+    enum class CardLayer { STACK, PLAYFIELD, BOTTOM_PILE, MOVING, COUNT };
+    void setupCardLayers();
+    void setCardViewZOrder(CardView* cardView, int zOrder);   // zOrder为GameUtils中的全局层级值
+    int getCardViewZOrder(const CardView* cardView) const;
+    
+    // 棋盘级触摸分发：整个棋盘只有一个监听器，通过空间哈希找到触点下层级最高的卡牌
+    void setupTouchDispatch();
+    void onMoveToTopTweensCompleted(const std::vector<int>& cardIds);
+    void onReturnTweensCompleted(const std::vector<int>& cardIds);
+    void rebuildHitGrid();
+    CardView* findCardAt(const cocos2d::Vec2& location);
     void createCardView(const CardModel& cardModel);
     void createCardViews(const std::vector<int>& cardIds, const GameModel& model);
+    
+    // 卡牌视图对象池：关卡切换和重开时复用，不再重复创建
+    CardView* acquireCardView();
+    void recycleCardViews();
     void createUndoButton();
-    int getCardJsonOrder(int cardId); // 获取卡牌在JSON中的顺序
+    void createRedoButton();
+    void createSpeedButton();   // 调试用：循环切换GameClock倍速
+    // useUndoCooldown为true时，回退冷却期间按钮不响应（回退/重做按钮）
+    void createControlButton(const std::string& title, const cocos2d::Vec2& position,
+                             const std::function<void()>& onClick, bool useUndoCooldown = true);
 
+    // 卡牌视图表：只在initializeWithModel（回收+重建）时增删，动画回调和控制器中只读或修改视图属性，
+    // 因此遍历与查找无需拷贝
     std::unordered_map<int, cocos2d::RefPtr<CardView>> _cardViews;
+    std::vector<cocos2d::RefPtr<CardView>> _cardViewPool;
+    cocos2d::Node* _cardLayers[(int)CardLayer::COUNT];
+    
+    // 脏标记：由模型变更事件填充，syncDirtyCardViews中消费
+    DirtyCardTracker _dirtyCards;
+    
+    BoardLayout _boardLayout;
+    CardTweener _tweener;
+    std::function<void()> _returnAnimationsCompleted;
+    CardHitGrid _hitGrid;
+    ToastLayer* _toastLayer;
+    int _idleBusyCheck;   // 空闲降帧的忙碌检查句柄，未注册时为0
+    bool _hitGridDirty;   // 卡牌位置或层级变化后置位，下次触摸时重建
+    int _touchedCardId;   // 当前按下的卡牌，没有时为-1
     GameController* _controller;
 };
 
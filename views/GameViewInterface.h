@@ -0,0 +1,47 @@
+#ifndef __GAME_VIEW_INTERFACE_H__
+#define __GAME_VIEW_INTERFACE_H__
+
+#include "cocos2d.h"
+#include <functional>
+
+/**
+ * @class GameViewInterface
+ * @brief 控制器所依赖的最小视图接口
+ * 
+ * 职责：
+ * - 只暴露卡牌控制器和回退控制器需要的视图操作（播放动画、刷新显示、恢复层级）
+ * - 由GameView实现；NullGameView为空实现，用于无界面地驱动控制器（测试、机器人、性能测量）
+ * 
+ * 播放动画的方法返回是否真正开始了动画：返回false时调用方应认为操作已立即完成。
+ */
+class GameViewInterface {
+public:
+    virtual ~GameViewInterface() {}
+
+    /**
+     * @brief 卡牌移动到底牌堆顶部；动画结束后视图负责通过GameController复位动画状态
+     * @return 是否开始了动画
+     */
+    virtual bool playCardMoveToTopAnimation(int cardId, const cocos2d::Vec2& originalPosition) = 0;
+
+    /**
+     * @brief 回退：卡牌从当前位置回到其所在牌堆的位置
+     * @return 是否开始了动画（已在目标位置时不播放）
+     */
+    virtual bool playCardReturnAnimation(int cardId) = 0;
+    virtual bool isPlayingReturnAnimations() const = 0;
+
+    /**
+     * @brief 设置回退动画完成回调（同一帧完成的一批动画回调一次）
+     */
+    virtual void setReturnAnimationsCompletedCallback(const std::function<void()>& callback) = 0;
+
+    // 刷新单张卡牌的牌面显示（正反面）
+    virtual void refreshCardDisplay(int cardId) = 0;
+    virtual void updateTopCardDisplay() = 0;
+
+    // 按模型恢复所有卡牌的层级
+    virtual void restoreCardZOrders() = 0;
+};
+
+#endif // __GAME_VIEW_INTERFACE_H__
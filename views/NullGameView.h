@@ -0,0 +1,25 @@
+#ifndef __NULL_GAME_VIEW_H__
+#define __NULL_GAME_VIEW_H__
+
+#include "GameViewInterface.h"
+
+/**
+ * @class NullGameView
+ * @brief GameViewInterface的空实现
+ * 
+ * 不创建任何节点、不播放动画，所有操作立即完成，无需OpenGL上下文。
+ * 用于日志回放以及测试、机器人、性能测量中全速驱动真实的控制器逻辑。
+ * 无界面运行时没有视图消费模型变更事件，驱动方应关闭模型的变更事件（GameModel::setChangeEventsEnabled）。
+ */
+class NullGameView : public GameViewInterface {
+public:
+    bool playCardMoveToTopAnimation(int /*cardId*/, const cocos2d::Vec2& /*originalPosition*/) override { return false; }
+    bool playCardReturnAnimation(int /*cardId*/) override { return false; }
+    bool isPlayingReturnAnimations() const override { return false; }
+    void setReturnAnimationsCompletedCallback(const std::function<void()>& /*callback*/) override {}
+    void refreshCardDisplay(int /*cardId*/) override {}
+    void updateTopCardDisplay() override {}
+    void restoreCardZOrders() override {}
+};
+
+#endif // __NULL_GAME_VIEW_H__
@@ -0,0 +1,103 @@
+#include "ToastLayer.h"
+#include "../utils/GameUtils.h"
+
+USING_NS_CC;
+
+bool ToastLayer::init() {
+    if (!Node::init()) {
+        return false;
+    }
+
+    // 标签一次性创建，位图字体的字形来自预先生成的图集，之后不再光栅化
+    for (Slot& slot : _slots) {
+        slot.label = GameUtils::createUILabel("", FONT_SIZE);
+        slot.label->setVisible(false);
+        this->addChild(slot.label);
+    }
+
+    _activeCount = 0;
+    return true;
+}
+
+void ToastLayer::show(const std::string& text, const Vec2& position, const Color3B& color, float duration) {
+    Slot* slot = findSlot(text, position);
+
+    // 文字不同时才重新排版
+    if (slot->text != text) {
+        slot->text = text;
+        slot->label->setString(text);
+    }
+    slot->label->setPosition(position);
+    slot->label->setColor(color);
+    slot->label->setOpacity(255);
+    slot->label->setVisible(true);
+    slot->remaining = duration;
+
+    if (!slot->active) {
+        slot->active = true;
+        if (_activeCount++ == 0) {
+            scheduleUpdate();
+        }
+    }
+}
+
+void ToastLayer::hideAll() {
+    for (Slot& slot : _slots) {
+        if (slot.active) {
+            deactivate(slot);
+        }
+    }
+}
+
+void ToastLayer::update(float dt) {
+    Node::update(dt);
+
+    for (Slot& slot : _slots) {
+        if (!slot.active) {
+            continue;
+        }
+
+        slot.remaining -= dt;
+        if (slot.remaining <= 0.0f) {
+            deactivate(slot);
+        } else if (slot.remaining < FADE_DURATION) {
+            slot.label->setOpacity((uint8_t)(255.0f * slot.remaining / FADE_DURATION));
+        }
+    }
+}
+
+ToastLayer::Slot* ToastLayer::findSlot(const std::string& text, const Vec2& position) {
+    Slot* freeSlot = nullptr;
+    Slot* oldestSlot = nullptr;
+
+    for (Slot& slot : _slots) {
+        if (!slot.active) {
+            // 优先复用上次显示过同样文字的空闲标签，省去重新排版
+            if (!freeSlot || slot.text == text) {
+                freeSlot = &slot;
+            }
+            continue;
+        }
+
+        // 同一条提示正在显示：只重置计时
+        if (slot.text == text && slot.label->getPosition() == position) {
+            return &slot;
+        }
+
+        if (!oldestSlot || slot.remaining < oldestSlot->remaining) {
+            oldestSlot = &slot;
+        }
+    }
+
+    return freeSlot ? freeSlot : oldestSlot;
+}
+
+void ToastLayer::deactivate(Slot& slot) {
+    slot.active = false;
+    slot.remaining = 0.0f;
+    slot.label->setVisible(false);
+
+    if (--_activeCount == 0) {
+        unscheduleUpdate();
+    }
+}
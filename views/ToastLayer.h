@@ -0,0 +1,62 @@
+#ifndef __TOAST_LAYER_H__
+#define __TOAST_LAYER_H__
+
+#include "cocos2d.h"
+#include <string>
+
+/**
+ * @class ToastLayer
+ * @brief 提示信息层
+ *
+ * 职责：
+ * - 初始化时创建固定数量的位图字体标签，之后只复用不再创建
+ * - 显示、计时和淡出由本层每帧推进，不为每条提示创建动作
+ * - 同一条提示正在显示时再次触发只重置计时，连续触发不产生任何开销
+ *
+ * 池满时复用剩余时间最短的标签。没有提示显示时不参与每帧更新。
+ */
+class ToastLayer : public cocos2d::Node {
+public:
+    static constexpr int POOL_SIZE = 4;
+    static constexpr float DEFAULT_DURATION = 2.0f;
+    static constexpr float FADE_DURATION = 0.3f;
+    static constexpr float FONT_SIZE = 16.0f;
+
+    CREATE_FUNC(ToastLayer);
+
+    virtual bool init() override;
+    virtual void update(float dt) override;
+
+    /**
+     * @brief 显示一条提示
+     * @param text 提示文字
+     * @param position 显示位置（本层坐标）
+     * @param color 文字颜色
+     * @param duration 显示时长（秒，含淡出）
+     */
+    void show(const std::string& text, const cocos2d::Vec2& position,
+              const cocos2d::Color3B& color, float duration = DEFAULT_DURATION);
+
+    /**
+     * @brief 立即隐藏所有提示
+     */
+    void hideAll();
+
+    bool hasVisibleToasts() const { return _activeCount > 0; }
+
+private:
+    struct Slot {
+        cocos2d::RefPtr<cocos2d::Label> label;
+        std::string text;
+        float remaining = 0.0f;
+        bool active = false;
+    };
+
+    Slot _slots[POOL_SIZE];
+    int _activeCount = 0;
+
+    Slot* findSlot(const std::string& text, const cocos2d::Vec2& position);
+    void deactivate(Slot& slot);
+};
+
+#endif // __TOAST_LAYER_H__